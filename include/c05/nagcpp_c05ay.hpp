@@ -152,6 +152,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
         retval = f(callbacks, en_data, x);
 
       } catch (...) {
@@ -186,6 +187,8 @@ namespace nagcpp {
     void contfn_brent(const double a, const double b, F &&f, double &x,
                       roots::OptionalC05AY &opt) {
       opt.fail.prepare("roots::contfn_brent (c05ay)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       double local_machpr = machine::precision();
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
@@ -194,6 +197,7 @@ namespace nagcpp {
       en_data.wrapptr1 = &ep;
       data_handling::CallbackAddresses callbacks(1);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       static_assert(
         !(std::is_same<std::nullptr_t,
                        typename std::remove_reference<F>::type>::value),
@@ -212,9 +216,12 @@ namespace nagcpp {
       void *local_iuser = nullptr;
       void *local_ruser = nullptr;
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler, {"f"});
       c05ayft_(en_data, a, b, local_eps, local_eta, local_f, local_fsub,
                c05ay_fh, x, local_iuser, local_ruser, opt.fail.errbuf,
                opt.fail.errorid, opt.fail.errbuf_length);
+      solve_timer.stop();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 1001) {
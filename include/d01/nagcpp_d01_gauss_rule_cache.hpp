@@ -0,0 +1,357 @@
+// Header for nagcpp::quad::GaussRuleCache
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_D01_GAUSS_RULE_CACHE_HPP
+#define NAGCPP_D01_GAUSS_RULE_CACHE_HPP
+
+#include "d01/nagcpp_d01tb.hpp"
+#include "utility/nagcpp_data_handling.hpp"
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_error_handler.hpp"
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nagcpp {
+  namespace quad {
+    // GaussRuleCache
+    // Cache of the Gaussian quadrature rules returned by
+    // quad::dim1_gauss_wres (d01tb), for when the same few rules are
+    // requested many times with different values of a and b.
+    // Each rule is computed once, by a call to quad::dim1_gauss_wres with a
+    // canonical choice of a and b, and is stored keyed on (key, n). On
+    // lookup the stored rule is mapped to the requested a and b:
+    //   key = 0 (Gauss-Legendre), canonical (a, b) = (-1, 1)
+    //     x = (a+b)/2 + t*(b-a)/2, w = w_0*(b-a)/2
+    //   key = 3, -3 (Gauss-Laguerre), canonical (a, b) = (0, 1)
+    //     x = a + t/b, w = w_0*exp(-a*b)/abs(b) (normal weights, key = 3)
+    //     or w = w_0/abs(b) (adjusted weights, key = -3)
+    //   key = 4, -4 (Gauss-Hermite), canonical (a, b) = (0, 1)
+    //     x = a + t/sqrt(b), w = w_0/sqrt(b)
+    //   key = -5 (rational Gauss), canonical (a, b) = (0, 1)
+    //     x = a + t*(a+b), w = w_0*abs(a+b)
+    // where t and w_0 are the stored abscissae and weights, which follows
+    // from the weight functions given in the d01tb documentation.
+    // The cache holds at most max_points abscissa / weight pairs, once this
+    // is exceeded the least recently used rules are discarded.
+    // Any number of threads may use the same cache. The engine is called
+    // without holding the lock, so two threads that miss on the same rule
+    // at the same time may both compute it.
+
+    // GaussRuleCache(max_points)
+    // parameters:
+    //   max_points: size_t
+    //     The maximum number of abscissae (and weights) to store, summed
+    //     over all of the cached rules
+
+    // methods:
+    //   dim1_gauss_wres(key, a, b, n, weight, abscis, opt)
+    //     As quad::dim1_gauss_wres (d01tb), but takes the rule from the
+    //     cache if it is there. The results agree with those from d01tb to
+    //     within rounding error. Calls that d01tb would reject, and rules
+    //     for which d01tb returns a warning (e.g. errorid 1, the n-point
+    //     rule is not among those stored), are passed straight to
+    //     quad::dim1_gauss_wres and are not cached, so the same errors and
+    //     warnings are raised. The underflow warning (errorid 2), which
+    //     depends on a and b, is only raised for calls that are passed
+    //     through, use adjusted weights if that is a concern
+    //   precompute(key, n, opt), precompute(keys, ns, opt)
+    //     Computes and stores the rules for key and n (or for every
+    //     combination of keys and ns), e.g. at start up, so the first
+    //     lookup does not have to call the engine. Errors and warnings are
+    //     raised as for quad::dim1_gauss_wres
+    //   get_nrules(): the number of rules in the cache
+    //   get_npoints(): the number of abscissae stored in the cache
+    //   get_max_points(), set_max_points(max_points): the size limit,
+    //     reducing it discards rules if required
+    //   get_nhits(), get_nmisses(): the number of lookups that were, and
+    //     were not, satisfied from the cache
+    //   clear(): discards all of the rules and resets the counts
+    class GaussRuleCache {
+    private:
+      typedef std::pair<types::f77_integer, types::f77_integer> RuleKey;
+      // a rule on the canonical interval, or a marker (with no abscissae)
+      // for a rule that d01tb only returns with a warning
+      struct Rule {
+        RuleKey rule_key;
+        bool valid;
+        std::vector<double> weight;
+        std::vector<double> abscis;
+        Rule(const RuleKey &rule_key_)
+          : rule_key(rule_key_), valid(false) {}
+        // markers are counted as a single point
+        size_t npoints(void) const {
+          return weight.empty() ? 1 : weight.size();
+        }
+      };
+      typedef std::list<std::shared_ptr<const Rule>> RuleList;
+
+      size_t max_points;
+      size_t npoints;
+      size_t nhits;
+      size_t nmisses;
+      // rules, most recently used first
+      RuleList rules;
+      std::map<RuleKey, RuleList::iterator> index;
+      mutable std::mutex cache_mtx;
+
+    public:
+      GaussRuleCache(const size_t max_points_ = 65536)
+        : max_points(max_points_), npoints(0), nhits(0), nmisses(0) {}
+      GaussRuleCache(const GaussRuleCache &) = delete;
+      GaussRuleCache &operator=(const GaussRuleCache &) = delete;
+
+      template <typename WEIGHT, typename ABSCIS>
+      void dim1_gauss_wres(const types::f77_integer key, const double a,
+                           const double b, const types::f77_integer n,
+                           WEIGHT &&weight, ABSCIS &&abscis,
+                           quad::OptionalD01TB &opt) {
+        std::shared_ptr<const Rule> rule;
+        if (is_mappable(key, a, b, n)) {
+          rule = lookup(RuleKey(key, n));
+          if (!rule) {
+            rule = compute(key, n, opt);
+          }
+        }
+        if (!rule || !rule->valid) {
+          quad::dim1_gauss_wres(key, a, b, n, weight, abscis, opt);
+          return;
+        }
+
+        opt.fail.prepare("quad::GaussRuleCache::dim1_gauss_wres");
+        data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                               typename std::remove_reference<WEIGHT>::type>
+          local_weight(weight);
+        local_weight.resize(weight, n);
+        data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                               typename std::remove_reference<ABSCIS>::type>
+          local_abscis(abscis);
+        local_abscis.resize(abscis, n);
+
+        local_abscis.check(opt.fail, "abscis", true, n);
+        if (opt.fail.error_thrown) {
+          return;
+        }
+        local_weight.check(opt.fail, "weight", true, n);
+        if (opt.fail.error_thrown) {
+          return;
+        }
+
+        double shift, scale, wscale;
+        affine_map(key, a, b, shift, scale, wscale);
+        for (size_t i = 0; i < rule->weight.size(); ++i) {
+          local_abscis.data[i] = shift + scale * rule->abscis[i];
+          local_weight.data[i] = wscale * rule->weight[i];
+        }
+
+        local_weight.copy_back(weight);
+        local_abscis.copy_back(abscis);
+      }
+
+      // alt-1
+      template <typename WEIGHT, typename ABSCIS>
+      void dim1_gauss_wres(const types::f77_integer key, const double a,
+                           const double b, const types::f77_integer n,
+                           WEIGHT &&weight, ABSCIS &&abscis) {
+        quad::OptionalD01TB local_opt;
+
+        dim1_gauss_wres(key, a, b, n, weight, abscis, local_opt);
+      }
+
+      void precompute(const types::f77_integer key,
+                      const types::f77_integer n, quad::OptionalD01TB &opt) {
+        std::shared_ptr<Rule> rule = std::make_shared<Rule>(RuleKey(key, n));
+        quad::dim1_gauss_wres(key, canonical_a(key), 1.0, n, rule->weight,
+                              rule->abscis, opt);
+        if (opt.fail.error_thrown) {
+          return;
+        }
+        rule->valid = !opt.fail.warning_thrown;
+        if (!rule->valid) {
+          rule->weight.clear();
+          rule->abscis.clear();
+        }
+        insert(rule);
+      }
+      void precompute(const std::vector<types::f77_integer> &keys,
+                      const std::vector<types::f77_integer> &ns,
+                      quad::OptionalD01TB &opt) {
+        for (types::f77_integer key : keys) {
+          for (types::f77_integer n : ns) {
+            precompute(key, n, opt);
+            if (opt.fail.error_thrown) {
+              return;
+            }
+          }
+        }
+      }
+
+      // alt-1
+      void precompute(const types::f77_integer key,
+                      const types::f77_integer n) {
+        quad::OptionalD01TB local_opt;
+
+        precompute(key, n, local_opt);
+      }
+      void precompute(const std::vector<types::f77_integer> &keys,
+                      const std::vector<types::f77_integer> &ns) {
+        quad::OptionalD01TB local_opt;
+
+        precompute(keys, ns, local_opt);
+      }
+
+      size_t get_nrules(void) const {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        return rules.size();
+      }
+      size_t get_npoints(void) const {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        return npoints;
+      }
+      size_t get_max_points(void) const {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        return max_points;
+      }
+      void set_max_points(const size_t max_points_) {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        max_points = max_points_;
+        evict();
+      }
+      size_t get_nhits(void) const {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        return nhits;
+      }
+      size_t get_nmisses(void) const {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        return nmisses;
+      }
+      void clear(void) {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        rules.clear();
+        index.clear();
+        npoints = 0;
+        nhits = 0;
+        nmisses = 0;
+      }
+
+    private:
+      static double canonical_a(const types::f77_integer key) {
+        return (key == 0) ? -1.0 : 0.0;
+      }
+      // true if d01tb would accept the arguments, anything else is passed
+      // straight to the engine so that it can raise the error
+      static bool is_mappable(const types::f77_integer key, const double a,
+                              const double b, const types::f77_integer n) {
+        if (n < 1) {
+          return false;
+        }
+        switch (key) {
+        case 0:
+          return true;
+        case 3:
+        case -3:
+          return std::abs(b) > 0.0;
+        case 4:
+        case -4:
+          return b > 0.0;
+        case -5:
+          return std::abs(a + b) > 0.0;
+        default:
+          return false;
+        }
+      }
+      static void affine_map(const types::f77_integer key, const double a,
+                             const double b, double &shift, double &scale,
+                             double &wscale) {
+        switch (key) {
+        case 0:
+          shift = 0.5 * (a + b);
+          scale = wscale = 0.5 * (b - a);
+          break;
+        case 3:
+        case -3:
+          shift = a;
+          scale = 1.0 / b;
+          wscale = (key == 3) ? std::exp(-a * b) / std::abs(b)
+                              : 1.0 / std::abs(b);
+          break;
+        case 4:
+        case -4:
+          shift = a;
+          scale = wscale = 1.0 / std::sqrt(b);
+          break;
+        default:
+          shift = a;
+          scale = a + b;
+          wscale = std::abs(a + b);
+          break;
+        }
+      }
+
+      std::shared_ptr<const Rule> lookup(const RuleKey &rule_key) {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        auto it = index.find(rule_key);
+        if (it == index.end()) {
+          ++nmisses;
+          return nullptr;
+        }
+        ++nhits;
+        rules.splice(rules.begin(), rules, it->second);
+        return rules.front();
+      }
+      // computes the canonical rule, errors are not expected (the arguments
+      // have been checked) but any error or warning marks the rule as one
+      // to pass through to quad::dim1_gauss_wres
+      std::shared_ptr<const Rule> compute(const types::f77_integer key,
+                                          const types::f77_integer n,
+                                          const quad::OptionalD01TB &opt) {
+        std::shared_ptr<Rule> rule = std::make_shared<Rule>(RuleKey(key, n));
+        quad::OptionalD01TB local_opt;
+        local_opt.fail.error_handler_type =
+          error_handler::ErrorHandlerType::ThrowNothing;
+        local_opt.workspace_allocator = opt.workspace_allocator;
+        quad::dim1_gauss_wres(key, canonical_a(key), 1.0, n, rule->weight,
+                              rule->abscis, local_opt);
+        rule->valid = !(local_opt.fail.error_thrown ||
+                        local_opt.fail.warning_thrown);
+        if (!rule->valid) {
+          rule->weight.clear();
+          rule->abscis.clear();
+        }
+        return insert(rule);
+      }
+      // adds a rule (keeping the existing one if another thread got there
+      // first) and returns the rule now held for its key
+      std::shared_ptr<const Rule> insert(std::shared_ptr<const Rule> rule) {
+        std::lock_guard<std::mutex> lock(cache_mtx);
+        auto it = index.find(rule->rule_key);
+        if (it != index.end()) {
+          rules.splice(rules.begin(), rules, it->second);
+          return rules.front();
+        }
+        rules.push_front(rule);
+        index[rule->rule_key] = rules.begin();
+        npoints += rule->npoints();
+        evict();
+        return rule;
+      }
+      // discards the least recently used rules until the cache fits, the
+      // caller must hold cache_mtx
+      void evict(void) {
+        while (npoints > max_points && !rules.empty()) {
+          const Rule &last = *rules.back();
+          npoints -= last.npoints();
+          index.erase(last.rule_key);
+          rules.pop_back();
+        }
+      }
+    };
+  }
+}
+#endif
@@ -13,7 +13,12 @@
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
 #include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace nagcpp {
   namespace quad {
@@ -146,6 +151,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
         retval = f(callbacks, en_data, local_x);
 
       } catch (...) {
@@ -194,6 +200,8 @@ namespace nagcpp {
     double md_gauss(const NPTVEC &nptvec, const WEIGHT &weight,
                     const ABSCIS &abscis, F &&f, quad::OptionalD01FB &opt) {
       opt.fail.prepare("quad::md_gauss (d01fb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -211,6 +219,7 @@ namespace nagcpp {
         local_abscis(abscis);
       data_handling::CallbackAddresses callbacks(1);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       static_assert(
         !(std::is_same<std::nullptr_t,
                        typename std::remove_reference<F>::type>::value),
@@ -252,10 +261,13 @@ namespace nagcpp {
         return std::numeric_limits<double>::quiet_NaN();
       }
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler, {"f"});
       d01fbft_(en_data, local_ndim, local_nptvec.data, local_lwa,
                local_weight.data, local_abscis.data, local_f, local_fsub,
                d01fb_fh, local_mdint, local_iuser, local_ruser, opt.fail.errbuf,
                opt.fail.errorid, opt.fail.errbuf_length);
+      solve_timer.stop();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 99997) {
@@ -297,6 +309,319 @@ namespace nagcpp {
 
       return local_mdint;
     }
+
+    // md_gauss_batch
+    // Multidimensional Gaussian quadrature over hyper-rectangle, with the
+    // integrand evaluated at a batch of points per call.
+    // quad::md_gauss_batch computes the same estimate as quad::md_gauss
+    // (d01fb), but forms the product rule itself rather than calling the
+    // engine: the abscissae of the tensor product grid are generated in
+    // blocks of (at most) opt.batch_size points, f is called once per
+    // block and the weighted sum is accumulated, optionally using
+    // opt.nthreads threads. The points are visited with the first dimension
+    // varying fastest.
+
+    // parameters:
+    //   nptvec: types::f77_integer, array, shape(ndim)
+    //     as for quad::md_gauss (d01fb)
+    //   weight: double, array, shape(lwa)
+    //     as for quad::md_gauss (d01fb), e.g. from quad::dim1_gauss_wres
+    //     (d01tb)
+    //   abscis: double, array, shape(lwa)
+    //     as for quad::md_gauss (d01fb), e.g. from quad::dim1_gauss_wres
+    //     (d01tb)
+    //   f: void, function
+    //     f must return the values of the integrand at a batch of points
+    //     f(ndim, npts, x, fx)
+    //     parameters:
+    //       ndim: types::f77_integer, scalar
+    //         n, the number of dimensions of the integral
+    //       npts: types::f77_integer, scalar
+    //         The number of points in the batch
+    //       x: const utility::vector_view<const double>, shape(ndim*npts)
+    //         The coordinates of the points, x[j*npts+i] holds the jth
+    //         coordinate of the ith point
+    //       fx: utility::vector_view<double>, shape(npts)
+    //         On exit: fx[i] must contain the value of the integrand at the
+    //         ith point
+    //     if opt.nthreads is not 1, f is called concurrently from more than
+    //     one thread
+    //   opt: quad::OptionalD01FBBatch
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       fail: error_handler::ErrorHandler
+    //       batch_size: types::f77_integer
+    //         The maximum number of points passed to f in a single call
+    //         Default = 4096
+    //       nthreads: int
+    //         The number of threads used, nthreads <= 0 means use the
+    //         number of hardware threads
+    //         Default = 1
+
+    // returns: double, scalar
+    //   The estimate of the integral. The order in which the weighted values
+    //   are summed depends on batch_size and nthreads, so the result can
+    //   differ from quad::md_gauss (d01fb) in the last few bits
+
+    // error_handler::ErrorException
+    //   (errorid 1)
+    //     On entry, lwa is too small.
+    //     lwa = <value>.
+    //     Minimum possible dimension: <value>.
+    //   (errorid 1)
+    //     On entry, ndim = <value>.
+    //     Constraint: ndim >= 1.
+    //   (errorid 1)
+    //     On entry, nptvec[<value>] = <value>.
+    //     Constraint: nptvec[j-1] >= 1.
+    //   (errorid 1)
+    //     On entry, nptvec gives too many points in the product rule.
+    //     Constraint: the product of the elements of nptvec must be at most
+    //     <value>.
+    //   (errorid 2)
+    //     On entry, opt.batch_size = <value>.
+    //     Constraint: opt.batch_size >= 1.
+    //   (errorid 10601)
+    //     On entry, argument <value> must be a vector of size <value> array.
+    //   (errorid 10602)
+    //     On entry, the raw data component of <value> is null.
+
+    // error_handler::CallbackException
+    //   (errorid 10701)
+    //     An exception was thrown in a callback.
+
+    class OptionalD01FBBatch : public utility::Optional {
+    private:
+      types::f77_integer batch_size_value;
+      int nthreads_value;
+
+    public:
+      OptionalD01FBBatch()
+        : Optional(), batch_size_value(4096), nthreads_value(1) {}
+      OptionalD01FBBatch &batch_size(types::f77_integer value) {
+        batch_size_value = value;
+        return (*this);
+      }
+      types::f77_integer get_batch_size(void) { return batch_size_value; }
+      OptionalD01FBBatch &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
+      template <typename NPTVEC, typename WEIGHT, typename ABSCIS, typename F>
+      friend double md_gauss_batch(const NPTVEC &nptvec, const WEIGHT &weight,
+                                   const ABSCIS &abscis, F &&f,
+                                   quad::OptionalD01FBBatch &opt);
+    };
+
+    template <typename NPTVEC, typename WEIGHT, typename ABSCIS, typename F>
+    double md_gauss_batch(const NPTVEC &nptvec, const WEIGHT &weight,
+                          const ABSCIS &abscis, F &&f,
+                          quad::OptionalD01FBBatch &opt) {
+      opt.fail.prepare("quad::md_gauss_batch");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
+      types::engine_data en_data;
+      engine_routines::y90haan_(en_data);
+      error_handler::ExceptionPointer ep;
+      en_data.wrapptr1 = &ep;
+      data_handling::RawData<types::f77_integer,
+                             data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<NPTVEC>::type>
+        local_nptvec(nptvec);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<WEIGHT>::type>
+        local_weight(weight);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<ABSCIS>::type>
+        local_abscis(abscis);
+      static_assert(
+        !(std::is_same<std::nullptr_t,
+                       typename std::remove_reference<F>::type>::value),
+        "nullptr is not a valid input as no default function is available for "
+        "f");
+
+      types::f77_integer local_ndim =
+        data_handling::get_size(opt.fail, "ndim", local_nptvec, 1);
+      if (opt.fail.error_thrown) {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      types::f77_integer local_lwa =
+        data_handling::get_size(opt.fail, "lwa", local_weight, 1, local_abscis,
+                                1);
+      if (opt.fail.error_thrown) {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      local_abscis.check(opt.fail, "abscis", true, local_lwa);
+      if (opt.fail.error_thrown) {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      local_weight.check(opt.fail, "weight", true, local_lwa);
+      if (opt.fail.error_thrown) {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      local_nptvec.check(opt.fail, "nptvec", true, local_ndim);
+      if (opt.fail.error_thrown) {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+
+      if (local_ndim < 1) {
+        opt.fail.set_errorid(1, error_handler::ErrorCategory::Error,
+                             error_handler::ErrorType::GeneralError);
+        opt.fail.append_msg(true, "On entry, ndim = " +
+                                    std::to_string(local_ndim) + ".");
+        opt.fail.append_msg(false, "Constraint: ndim >= 1.");
+        opt.fail.throw_error();
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      size_t ndim = static_cast<size_t>(local_ndim);
+      // offset of the rule for each dimension in weight and abscis, and the
+      // number of points in the product rule
+      // (minlwa is held as a size_t, as the sum of nptvec need not fit in an
+      // f77_integer)
+      std::vector<size_t> offset(ndim);
+      size_t total = 1;
+      size_t minlwa = 0;
+      for (size_t j = 0; j < ndim; ++j) {
+        if (local_nptvec.data[j] < 1) {
+          opt.fail.set_errorid(1, error_handler::ErrorCategory::Error,
+                               error_handler::ErrorType::GeneralError);
+          opt.fail.append_msg(true, "On entry, nptvec[" + std::to_string(j) +
+                                      "] = " +
+                                      std::to_string(local_nptvec.data[j]) +
+                                      ".");
+          opt.fail.append_msg(false, "Constraint: nptvec[j-1] >= 1.");
+          opt.fail.throw_error();
+          return std::numeric_limits<double>::quiet_NaN();
+        }
+        size_t npts = static_cast<size_t>(local_nptvec.data[j]);
+        if (total > std::numeric_limits<size_t>::max() / npts) {
+          opt.fail.set_errorid(1, error_handler::ErrorCategory::Error,
+                               error_handler::ErrorType::GeneralError);
+          opt.fail.append_msg(false, "On entry, nptvec gives too many points "
+                                     "in the product rule.");
+          opt.fail.append_msg(
+            false, "Constraint: the product of the elements of nptvec must "
+                   "be at most " +
+                     std::to_string(std::numeric_limits<size_t>::max()) +
+                     ".");
+          opt.fail.throw_error();
+          return std::numeric_limits<double>::quiet_NaN();
+        }
+        offset[j] = minlwa;
+        minlwa += npts;
+        total *= npts;
+      }
+      if (static_cast<size_t>(local_lwa) < minlwa) {
+        opt.fail.set_errorid(1, error_handler::ErrorCategory::Error,
+                             error_handler::ErrorType::GeneralError);
+        opt.fail.append_msg(false, "On entry, lwa is too small.");
+        opt.fail.append_msg(false,
+                            "lwa = " + std::to_string(local_lwa) + ".");
+        opt.fail.append_msg(false, "Minimum possible dimension: " +
+                                     std::to_string(minlwa) + ".");
+        opt.fail.throw_error();
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      types::f77_integer local_batch_size = opt.batch_size_value;
+      if (local_batch_size < 1) {
+        opt.fail.set_errorid(2, error_handler::ErrorCategory::Error,
+                             error_handler::ErrorType::GeneralError);
+        opt.fail.append_msg(true, "On entry, opt.batch_size = " +
+                                    std::to_string(local_batch_size) + ".");
+        opt.fail.append_msg(false, "Constraint: opt.batch_size >= 1.");
+        opt.fail.throw_error();
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      size_t batch_size =
+        std::min(static_cast<size_t>(local_batch_size), total);
+      size_t nbatches = total / batch_size + (total % batch_size != 0);
+      size_t nchunks = std::min(utility::thread_count(opt.nthreads_value),
+                                nbatches);
+      std::vector<double> partial(nchunks, 0.0);
+      // set if f throws, so that the remaining batches are skipped
+      std::atomic<bool> failed(false);
+      utility::CallbackProfiler *profiler = opt.callback_profiler.get();
+
+      auto run_batches = [&](size_t begin, size_t end, size_t ichunk) {
+        std::vector<double> x(ndim * batch_size);
+        std::vector<double> w(batch_size);
+        std::vector<double> fx(batch_size);
+        std::vector<size_t> idx(ndim);
+        double sum = 0.0;
+        for (size_t ib = begin; ib < end && !failed; ++ib) {
+          size_t first = ib * batch_size;
+          size_t npts = std::min(batch_size, total - first);
+          // index of the first point of the batch in each dimension
+          size_t rem = first;
+          for (size_t j = 0; j < ndim; ++j) {
+            size_t nj = static_cast<size_t>(local_nptvec.data[j]);
+            idx[j] = rem % nj;
+            rem /= nj;
+          }
+          for (size_t i = 0; i < npts; ++i) {
+            double wi = 1.0;
+            for (size_t j = 0; j < ndim; ++j) {
+              wi *= local_weight.data[offset[j] + idx[j]];
+              x[j * npts + i] = local_abscis.data[offset[j] + idx[j]];
+            }
+            w[i] = wi;
+            for (size_t j = 0; j < ndim; ++j) {
+              if (++idx[j] < static_cast<size_t>(local_nptvec.data[j])) {
+                break;
+              }
+              idx[j] = 0;
+            }
+          }
+          utility::vector_view<const double> xv(x.data(), ndim * npts);
+          utility::vector_view<double> fxv(fx.data(), npts);
+          try {
+            utility::CallbackProfiler::CallTimer timer(profiler, 0);
+            f(local_ndim, static_cast<types::f77_integer>(npts), xv, fxv);
+          } catch (...) {
+            failed = true;
+            throw;
+          }
+          for (size_t i = 0; i < npts; ++i) {
+            sum += w[i] * fx[i];
+          }
+        }
+        partial[ichunk] = sum;
+      };
+
+      utility::CallbackProfiler::SolveTimer solve_timer(profiler, {"f"});
+      try {
+        utility::parallel_for(nbatches, static_cast<int>(nchunks),
+                              run_batches);
+      } catch (...) {
+        // callback threw an exception
+        en_data.hlperr = error_handler::HLPERR_USER_EXCEPTION;
+        ep.eptr = std::current_exception();
+      }
+      solve_timer.stop();
+
+      if (en_data.hlperr != error_handler::HLPERR_SUCCESS) {
+        opt.fail.initial_error_handler(en_data);
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      double local_mdint = 0.0;
+      for (double sum : partial) {
+        local_mdint += sum;
+      }
+
+      return local_mdint;
+    }
+
+    // alt-1
+    template <typename NPTVEC, typename WEIGHT, typename ABSCIS, typename F>
+    double md_gauss_batch(const NPTVEC &nptvec, const WEIGHT &weight,
+                          const ABSCIS &abscis, F &&f) {
+      quad::OptionalD01FBBatch local_opt;
+
+      double local_mdint = md_gauss_batch(nptvec, weight, abscis, f, local_opt);
+
+      return local_mdint;
+    }
   }
 }
 #define d01fb quad::md_gauss
@@ -130,6 +130,8 @@ namespace nagcpp {
                          WEIGHT &&weight, ABSCIS &&abscis,
                          quad::OptionalD01TB &opt) {
       opt.fail.prepare("quad::dim1_gauss_wres (d01tb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
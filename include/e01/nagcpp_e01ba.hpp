@@ -103,6 +103,8 @@ namespace nagcpp {
     void dim1_spline(const X &x, const Y &y, LAMDA &&lamda, C &&c,
                      interp::OptionalE01BA &opt) {
       opt.fail.prepare("interp::dim1_spline (e01ba)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -12,6 +12,10 @@
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
 #include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
 
 namespace nagcpp {
   namespace fit {
@@ -88,18 +92,34 @@ namespace nagcpp {
     }
 
     class OptionalE02BB : public utility::Optional {
+    private:
+      int nthreads_value;
+
     public:
-      OptionalE02BB() : Optional() {}
+      OptionalE02BB() : Optional(), nthreads_value(1) {}
+      // number of threads used when evaluating the spline at more than one
+      // point (values <= 0 use std::thread::hardware_concurrency threads)
+      OptionalE02BB &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
       template <typename LAMDA, typename C>
       friend void dim1_spline_eval(const LAMDA &lamda, const C &c,
                                    const double x, double &s,
                                    fit::OptionalE02BB &opt);
+      template <typename LAMDA, typename C, typename X, typename S>
+      friend typename std::enable_if<!std::is_arithmetic<X>::value>::type
+        dim1_spline_eval(const LAMDA &lamda, const C &c, const X &x, S &&s,
+                         fit::OptionalE02BB &opt);
     };
 
     template <typename LAMDA, typename C>
     void dim1_spline_eval(const LAMDA &lamda, const C &c, const double x,
                           double &s, fit::OptionalE02BB &opt) {
       opt.fail.prepare("fit::dim1_spline_eval (e02bb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -165,6 +185,134 @@ namespace nagcpp {
 
       dim1_spline_eval(lamda, c, x, s, local_opt);
     }
+
+    // dim1_spline_eval (e02bb), multi-point interface
+    // Evaluates a cubic spline from its B-spline representation at each point
+    // held in a container.
+    // lamda and c are checked once for the whole set of points, rather than
+    // once per point, and the evaluation can be split across threads.
+
+    // parameters:
+    //   lamda: double, array, shape(ncap7)
+    //     lamda[j-1] must be set to the value of the jth member of the complete set
+    //     of knots, lambda_j, for j = 1,2,...,n_+7
+    //   c: double, array, shape(ncap7)
+    //     The coefficient c_i of the B-spline N_i(x), for i = 1,2,...,n_+3
+    //   x: double, array, shape(nx)
+    //     The arguments at which the cubic spline is to be evaluated, these do
+    //     not need to be sorted
+    //   s: double, array, shape(nx)
+    //     On exit: s[i] holds the value of the spline, s(x[i])
+    //   opt: fit::OptionalE02BB
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       nthreads: int, scalar
+    //         The number of threads the points are split across
+    //         default value: 1
+    //       fail: error_handler::ErrorHandler
+
+    // error_handler::ErrorException
+    //   as for the single point interface, the error is reported for the
+    //   first element of x that could not be evaluated
+
+    template <typename LAMDA, typename C, typename X, typename S>
+    typename std::enable_if<!std::is_arithmetic<X>::value>::type
+      dim1_spline_eval(const LAMDA &lamda, const C &c, const X &x, S &&s,
+                       fit::OptionalE02BB &opt) {
+      opt.fail.prepare("fit::dim1_spline_eval (e02bb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<LAMDA>::type>
+        local_lamda(lamda);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<C>::type>
+        local_c(c);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<X>::type>
+        local_x(x);
+
+      types::f77_integer local_ncap7 =
+        data_handling::get_size(opt.fail, "ncap7", local_lamda, 1, local_c, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      types::f77_integer local_nx =
+        data_handling::get_size(opt.fail, "nx", local_x, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                             typename std::remove_reference<S>::type>
+        local_s(s);
+      local_s.resize(s, local_nx);
+
+      local_s.check(opt.fail, "s", true, local_nx);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_x.check(opt.fail, "x", true, local_nx);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_c.check(opt.fail, "c", true, local_ncap7);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_lamda.check(opt.fail, "lamda", true, local_ncap7);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+
+      // index of the first point that could not be evaluated
+      size_t nx = static_cast<size_t>(local_nx);
+      std::atomic<size_t> first_failure(nx);
+      utility::parallel_for(
+        nx, opt.nthreads_value, [&](size_t begin, size_t end, size_t) {
+          types::engine_data en_data;
+          engine_routines::y90haan_(en_data);
+          en_data.allocate_workspace = constants::NAG_ED_YES;
+          char errbuf[error_handler::ErrorHandler::errbuf_length + 1];
+          types::f77_integer ifail;
+          for (size_t i = begin; i < end; ++i) {
+            ifail = 0;
+            e02bbft_(en_data, local_ncap7, local_lamda.data, local_c.data,
+                     local_x.data[i], local_s.data[i], errbuf, ifail,
+                     error_handler::ErrorHandler::errbuf_length);
+            if (ifail != 0) {
+              size_t current = first_failure.load();
+              while (i < current &&
+                     !first_failure.compare_exchange_weak(current, i))
+                ;
+              return;
+            }
+          }
+        });
+
+      if (first_failure < nx) {
+        // re-evaluate the failing point via the single point interface,
+        // so that the error is reported in the usual way
+        double local_sx;
+        dim1_spline_eval(lamda, c, local_x.data[first_failure.load()],
+                         local_sx, opt);
+        if (!(opt.fail.error_thrown)) {
+          opt.fail.raise_error_unexpected_error();
+        }
+        return;
+      }
+
+      local_s.copy_back(s);
+      opt.fail.throw_warning();
+    }
+
+    // alt-1
+    template <typename LAMDA, typename C, typename X, typename S>
+    typename std::enable_if<!std::is_arithmetic<X>::value>::type
+      dim1_spline_eval(const LAMDA &lamda, const C &c, const X &x, S &&s) {
+      fit::OptionalE02BB local_opt;
+
+      dim1_spline_eval(lamda, c, x, s, local_opt);
+    }
   }
 }
 #define e02bb fit::dim1_spline_eval
@@ -7,26 +7,323 @@
 #ifndef NAGCPP_COMME04RA
 #define NAGCPP_COMME04RA
 
+#include "e04/nagcpp_e04_options.hpp"
 #include "e04/nagcpp_e04ra.hpp"
 #include "e04/nagcpp_e04rz.hpp"
 #include "e04/nagcpp_e04zm.hpp"
 #include "e04/nagcpp_e04zn.hpp"
 #include "utility/nagcpp_utility_comm.hpp"
 #include "utility/nagcpp_utility_functions.hpp"
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace nagcpp {
   namespace opt {
     class CommE04RA : public utility::NoneCopyableComm {
     public:
-      CommE04RA(void *handle_) : NoneCopyableComm(handle_) {}
+      // options that can be queried via one of the named getters
+      enum class Option {
+        DFLSSmallResidualsTol,
+        DFNODetectUnbounded,
+        DFNOObjectiveLimit,
+        DFOInitialInterpPoints,
+        DFOMaxObjectiveCalls,
+        DFOMaxSoftRestarts,
+        DFOMaxUnsuccSoftRestarts,
+        DFOMaximumSlowSteps,
+        DFOMonitorFrequency,
+        DFONoiseLevel,
+        DFONoisyProblem,
+        DFONumberInitialPoints,
+        DFONumberInterpPoints,
+        DFONumberSoftRestartsPts,
+        DFOPrintFrequency,
+        DFORandomSeed,
+        DFOStartingTrustRegion,
+        DFOTrustRegionSlowTol,
+        DFOTrustRegionTolerance,
+        DIMACSMeasures,
+        FOASEstimateDerivatives,
+        FOASFiniteDiffInterval,
+        FOASIterationLimit,
+        FOASMemory,
+        FOASMonitorFrequency,
+        FOASPrintFrequency,
+        FOASProgressTolerance,
+        FOASRelStopTolerance,
+        FOASRestartFactor,
+        FOASSlowTolerance,
+        FOASStopTolerance,
+        FOASToleranceNorm,
+        HessianDensity,
+        HessianMode,
+        InfiniteBoundSize,
+        InitValueP,
+        InitValuePmat,
+        InitialP,
+        InitialU,
+        InitialValueUbox,
+        InitialValueUlin,
+        InitialValueUnln,
+        InitialX,
+        InnerIterationLimit,
+        InnerStopCriteria,
+        InnerStopTolerance,
+        LPIPMAlgorithm,
+        LPIPMCentralityCorrectors,
+        LPIPMIterationLimit,
+        LPIPMMaxIterativeRefinement,
+        LPIPMMonitorFrequency,
+        LPIPMScaling,
+        LPIPMStopTolerance,
+        LPIPMStopTolerance2,
+        LPIPMSystemFormulation,
+        LPPresolve,
+        LinesearchMode,
+        List,
+        MatrixOrdering,
+        MonitorFrequency,
+        MonitoringFile,
+        MonitoringLevel,
+        NLPFactorizationMethod,
+        OuterIterationLimit,
+        PMin,
+        PUpdateSpeed,
+        PmatMin,
+        Preference,
+        PresolveBlockDetect,
+        PrintFile,
+        PrintLevel,
+        PrintOptions,
+        PrintSolution,
+        SOCPFactorizationMethod,
+        SOCPIterationLimit,
+        SOCPMonitorFrequency,
+        SOCPPresolve,
+        SOCPScaling,
+        SOCPStopTolerance,
+        SOCPStopTolerance2,
+        SOCPSystemFormulation,
+        StatsTime,
+        StopCriteria,
+        StopTolerance1,
+        StopTolerance2,
+        StopToleranceFeasibility,
+        Task,
+        TimeLimit,
+        TransformConstraints,
+        UUpdateRestriction,
+        UmatUpdateRestriction,
+        VerifyDerivatives,
+        NumOptions
+      };
+
+    private:
+      // cache of the option values queried via the named getters ...
+      // an option is only read from the handle, via handle_opt_get (e04zn),
+      // the first time it is queried. The cache is cleared by any call to
+      // handle_opt_set (e04zm) for the handle, and replaced whenever the
+      // handle is initialized or freed.
+      // The cache is shared between all CommE04RA objects referring to the
+      // same handle, so is also used by the CommE04RA object passed to any
+      // monitoring function called by a solver
+      struct OptionValue {
+        bool cached = false;
+        types::f77_integer ivalue = 0;
+        double rvalue = 0.0;
+        std::string cvalue;
+      };
+      struct OptionCache {
+        OptionValue values[static_cast<size_t>(Option::NumOptions)];
+        void clear(void) {
+          for (auto &value : values) {
+            value.cached = false;
+          }
+        }
+      };
+      std::shared_ptr<OptionCache> option_cache;
+      // the handle the cache is registered against (nullptr if it is not
+      // registered)
+      void *registered_handle = nullptr;
+
+      static std::mutex &option_cache_mutex(void) {
+        static std::mutex mtx;
+        return mtx;
+      }
+      static std::unordered_map<void *, std::weak_ptr<OptionCache>> &
+        option_cache_registry(void) {
+        static std::unordered_map<void *, std::weak_ptr<OptionCache>> registry;
+        return registry;
+      }
+      // create a new cache for the handle held by this object, registering
+      // it if the handle was initialized by this object
+      void reset_option_cache(void) {
+        unregister_option_cache();
+        borrowed = false;
+        option_cache = std::make_shared<OptionCache>();
+        if (initialized) {
+          std::lock_guard<std::mutex> lock(option_cache_mutex());
+          option_cache_registry()[handle] = option_cache;
+          registered_handle = handle;
+        }
+      }
+      // share the cache of an existing handle, if the handle was
+      // initialized by another CommE04RA object it can also be used for
+      // querying and setting options
+      void attach_option_cache(void) {
+        {
+          std::lock_guard<std::mutex> lock(option_cache_mutex());
+          auto it = option_cache_registry().find(handle);
+          if (it != option_cache_registry().end()) {
+            option_cache = it->second.lock();
+          }
+        }
+        if (option_cache) {
+          borrowed = true;
+        } else {
+          option_cache = std::make_shared<OptionCache>();
+        }
+      }
+      void unregister_option_cache(void) {
+        if (registered_handle) {
+          std::lock_guard<std::mutex> lock(option_cache_mutex());
+          auto it = option_cache_registry().find(registered_handle);
+          if (it != option_cache_registry().end() &&
+              it->second.lock() == option_cache) {
+            option_cache_registry().erase(it);
+          }
+          registered_handle = nullptr;
+        }
+      }
+      static const char *option_name(Option id) {
+        static const char *const names[] = {
+          "DFLS Small Residuals Tol",
+          "DFNO Detect Unbounded",
+          "DFNO Objective Limit",
+          "DFO Initial Interp Points",
+          "DFO Max Objective Calls",
+          "DFO Max Soft Restarts",
+          "DFO Max Unsucc Soft Restarts",
+          "DFO Maximum Slow Steps",
+          "DFO Monitor Frequency",
+          "DFO Noise Level",
+          "DFO Noisy Problem",
+          "DFO Number Initial Points",
+          "DFO Number Interp Points",
+          "DFO Number Soft Restarts Pts",
+          "DFO Print Frequency",
+          "DFO Random Seed",
+          "DFO Starting Trust Region",
+          "DFO Trust Region Slow Tol",
+          "DFO Trust Region Tolerance",
+          "DIMACS Measures",
+          "FOAS Estimate Derivatives",
+          "FOAS Finite Diff Interval",
+          "FOAS Iteration Limit",
+          "FOAS Memory",
+          "FOAS Monitor Frequency",
+          "FOAS Print Frequency",
+          "FOAS Progress Tolerance",
+          "FOAS Rel Stop Tolerance",
+          "FOAS Restart Factor",
+          "FOAS Slow Tolerance",
+          "FOAS Stop Tolerance",
+          "FOAS Tolerance Norm",
+          "Hessian Density",
+          "Hessian Mode",
+          "Infinite Bound Size",
+          "Init Value P",
+          "Init Value Pmat",
+          "Initial P",
+          "Initial U",
+          "Initial Value Ubox",
+          "Initial Value Ulin",
+          "Initial Value Unln",
+          "Initial X",
+          "Inner Iteration Limit",
+          "Inner Stop Criteria",
+          "Inner Stop Tolerance",
+          "LPIPM Algorithm",
+          "LPIPM Centrality Correctors",
+          "LPIPM Iteration Limit",
+          "LPIPM Max Iterative Refinement",
+          "LPIPM Monitor Frequency",
+          "LPIPM Scaling",
+          "LPIPM Stop Tolerance",
+          "LPIPM Stop Tolerance 2",
+          "LPIPM System Formulation",
+          "LP Presolve",
+          "Linesearch Mode",
+          "List",
+          "Matrix Ordering",
+          "Monitor Frequency",
+          "Monitoring File",
+          "Monitoring Level",
+          "NLP Factorization Method",
+          "Outer Iteration Limit",
+          "P Min",
+          "P Update Speed",
+          "Pmat Min",
+          "Preference",
+          "Presolve Block Detect",
+          "Print File",
+          "Print Level",
+          "Print Options",
+          "Print Solution",
+          "SOCP Factorization Method",
+          "SOCP Iteration Limit",
+          "SOCP Monitor Frequency",
+          "SOCP Presolve",
+          "SOCP Scaling",
+          "SOCP Stop Tolerance",
+          "SOCP Stop Tolerance 2",
+          "SOCP System Formulation",
+          "Stats Time",
+          "Stop Criteria",
+          "Stop Tolerance 1",
+          "Stop Tolerance 2",
+          "Stop Tolerance Feasibility",
+          "Task",
+          "Time Limit",
+          "Transform Constraints",
+          "U Update Restriction",
+          "Umat Update Restriction",
+          "Verify Derivatives",
+        };
+        return names[static_cast<size_t>(id)];
+      }
+      const OptionValue &get_option(Option id) {
+        OptionValue &value = option_cache->values[static_cast<size_t>(id)];
+        if (!value.cached) {
+          opt::OptionalE04ZN local_opt;
+          types::f77_integer local_optype;
+          handle_opt_get((*this), option_name(id), value.ivalue, value.rvalue,
+                         value.cvalue, local_optype, local_opt);
+          value.cached = !local_opt.fail.error_thrown;
+        }
+        return value;
+      }
+      // ... cache of the option values queried via the named getters
+
+    public:
+      CommE04RA(void *handle_) : NoneCopyableComm(handle_) {
+        attach_option_cache();
+      }
       CommE04RA(const types::f77_integer nvar, opt::OptionalE04RA &opt)
         : NoneCopyableComm() {
+        reset_option_cache();
         handle_init((*this), nvar, opt);
       }
       CommE04RA(const types::f77_integer nvar) : NoneCopyableComm() {
+        reset_option_cache();
         handle_init((*this), nvar);
       }
       ~CommE04RA() {
+        unregister_option_cache();
         if (initialized) {
           try {
             handle_free((*this));
@@ -47,6 +344,69 @@ namespace nagcpp {
         handle_opt_set((*this), optstr);
         return (*this);
       }
+      // apply a number of option settings, each via handle_opt_set (e04zm),
+      // stopping at the first invalid setting
+      CommE04RA &set_options(const std::vector<std::string> &optstrs,
+                             opt::OptionalE04ZM &opt) {
+        for (const auto &optstr : optstrs) {
+          handle_opt_set((*this), optstr, opt);
+          if (opt.fail.error_thrown) {
+            break;
+          }
+        }
+        return (*this);
+      }
+      CommE04RA &set_options(const std::vector<std::string> &optstrs) {
+        opt::OptionalE04ZM local_opt;
+        return set_options(optstrs, local_opt);
+      }
+      // set an option via its descriptor in opt::e04zm_options, e.g.
+      // handle.set(opt::e04zm_options::PrintLevel, 1)
+      template <typename T, typename V>
+      CommE04RA &set(const utility::OptionDescriptor<CommE04RA, T> &option,
+                     const V &value, opt::OptionalE04ZM &opt) {
+        handle_opt_set((*this), utility::set_optstr(option, value), opt);
+        return (*this);
+      }
+      template <typename T, typename V>
+      CommE04RA &set(const utility::OptionDescriptor<CommE04RA, T> &option,
+                     const V &value) {
+        opt::OptionalE04ZM local_opt;
+        return set(option, value, local_opt);
+      }
+      CommE04RA &
+        set(const utility::OptionDescriptor<CommE04RA, utility::OptionKeyword>
+              &option,
+            opt::OptionalE04ZM &opt) {
+        handle_opt_set((*this), utility::set_optstr(option), opt);
+        return (*this);
+      }
+      CommE04RA &
+        set(const utility::OptionDescriptor<CommE04RA, utility::OptionKeyword>
+              &option) {
+        opt::OptionalE04ZM local_opt;
+        return set(option, local_opt);
+      }
+      CommE04RA &set_options(
+        std::initializer_list<utility::OptionSetting<CommE04RA>> settings,
+        opt::OptionalE04ZM &opt) {
+        for (const auto &setting : settings) {
+          handle_opt_set((*this), setting.str(), opt);
+          if (opt.fail.error_thrown) {
+            break;
+          }
+        }
+        return (*this);
+      }
+      CommE04RA &set_options(
+        std::initializer_list<utility::OptionSetting<CommE04RA>> settings) {
+        opt::OptionalE04ZM local_opt;
+        return set_options(settings, local_opt);
+      }
+      // called by handle_opt_set (e04zm)
+      void options_changed(void) override { option_cache->clear(); }
+      // called by handle_init (e04ra) and handle_free (e04rz)
+      void handle_changed(void) override { reset_option_cache(); }
       void get(const std::string optstr, types::f77_integer &ivalue,
                double &rvalue, std::string &cvalue, types::f77_integer &optype,
                opt::OptionalE04ZN &opt) {
@@ -72,14 +432,7 @@ namespace nagcpp {
         return DFLSSmallResidualsTol(value, local_opt);
       }
       double get_DFLSSmallResidualsTol(void) {
-        std::string local_optstr = "DFLS Small Residuals Tol";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFLSSmallResidualsTol).rvalue;
       }
 
       // DFNO Detect Unbounded:
@@ -97,14 +450,7 @@ namespace nagcpp {
         return DFNODetectUnbounded(value, local_opt);
       }
       std::string get_DFNODetectUnbounded(void) {
-        std::string local_optstr = "DFNO Detect Unbounded";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::DFNODetectUnbounded).cvalue;
       }
 
       // DFNO Objective Limit:
@@ -121,14 +467,7 @@ namespace nagcpp {
         return DFNOObjectiveLimit(value, local_opt);
       }
       double get_DFNOObjectiveLimit(void) {
-        std::string local_optstr = "DFNO Objective Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFNOObjectiveLimit).rvalue;
       }
 
       // DFO Initial Interp Points:
@@ -146,14 +485,7 @@ namespace nagcpp {
         return DFOInitialInterpPoints(value, local_opt);
       }
       std::string get_DFOInitialInterpPoints(void) {
-        std::string local_optstr = "DFO Initial Interp Points";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::DFOInitialInterpPoints).cvalue;
       }
 
       // DFO Max Objective Calls:
@@ -172,14 +504,7 @@ namespace nagcpp {
         return DFOMaxObjectiveCalls(value, local_opt);
       }
       types::f77_integer get_DFOMaxObjectiveCalls(void) {
-        std::string local_optstr = "DFO Max Objective Calls";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOMaxObjectiveCalls).ivalue;
       }
 
       // DFO Max Soft Restarts:
@@ -198,14 +523,7 @@ namespace nagcpp {
         return DFOMaxSoftRestarts(value, local_opt);
       }
       types::f77_integer get_DFOMaxSoftRestarts(void) {
-        std::string local_optstr = "DFO Max Soft Restarts";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOMaxSoftRestarts).ivalue;
       }
 
       // DFO Max Unsucc Soft Restarts:
@@ -225,14 +543,7 @@ namespace nagcpp {
         return DFOMaxUnsuccSoftRestarts(value, local_opt);
       }
       types::f77_integer get_DFOMaxUnsuccSoftRestarts(void) {
-        std::string local_optstr = "DFO Max Unsucc Soft Restarts";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOMaxUnsuccSoftRestarts).ivalue;
       }
 
       // DFO Maximum Slow Steps:
@@ -251,14 +562,7 @@ namespace nagcpp {
         return DFOMaximumSlowSteps(value, local_opt);
       }
       types::f77_integer get_DFOMaximumSlowSteps(void) {
-        std::string local_optstr = "DFO Maximum Slow Steps";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOMaximumSlowSteps).ivalue;
       }
 
       // DFO Monitor Frequency:
@@ -277,14 +581,7 @@ namespace nagcpp {
         return DFOMonitorFrequency(value, local_opt);
       }
       types::f77_integer get_DFOMonitorFrequency(void) {
-        std::string local_optstr = "DFO Monitor Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOMonitorFrequency).ivalue;
       }
 
       // DFO Noise Level:
@@ -302,14 +599,7 @@ namespace nagcpp {
         return DFONoiseLevel(value, local_opt);
       }
       double get_DFONoiseLevel(void) {
-        std::string local_optstr = "DFO Noise Level";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFONoiseLevel).rvalue;
       }
 
       // DFO Noisy Problem:
@@ -326,14 +616,7 @@ namespace nagcpp {
         return DFONoisyProblem(value, local_opt);
       }
       std::string get_DFONoisyProblem(void) {
-        std::string local_optstr = "DFO Noisy Problem";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::DFONoisyProblem).cvalue;
       }
 
       // DFO Number Initial Points:
@@ -352,14 +635,7 @@ namespace nagcpp {
         return DFONumberInitialPoints(value, local_opt);
       }
       types::f77_integer get_DFONumberInitialPoints(void) {
-        std::string local_optstr = "DFO Number Initial Points";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFONumberInitialPoints).ivalue;
       }
 
       // DFO Number Interp Points:
@@ -378,14 +654,7 @@ namespace nagcpp {
         return DFONumberInterpPoints(value, local_opt);
       }
       types::f77_integer get_DFONumberInterpPoints(void) {
-        std::string local_optstr = "DFO Number Interp Points";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFONumberInterpPoints).ivalue;
       }
 
       // DFO Number Soft Restarts Pts:
@@ -403,14 +672,7 @@ namespace nagcpp {
         return DFONumberSoftRestartsPts(value, local_opt);
       }
       types::f77_integer get_DFONumberSoftRestartsPts(void) {
-        std::string local_optstr = "DFO Number Soft Restarts Pts";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFONumberSoftRestartsPts).ivalue;
       }
 
       // DFO Print Frequency:
@@ -429,14 +691,7 @@ namespace nagcpp {
         return DFOPrintFrequency(value, local_opt);
       }
       types::f77_integer get_DFOPrintFrequency(void) {
-        std::string local_optstr = "DFO Print Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFOPrintFrequency).ivalue;
       }
 
       // DFO Random Seed:
@@ -455,14 +710,7 @@ namespace nagcpp {
         return DFORandomSeed(value, local_opt);
       }
       types::f77_integer get_DFORandomSeed(void) {
-        std::string local_optstr = "DFO Random Seed";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::DFORandomSeed).ivalue;
       }
 
       // DFO Starting Trust Region:
@@ -479,14 +727,7 @@ namespace nagcpp {
         return DFOStartingTrustRegion(value, local_opt);
       }
       double get_DFOStartingTrustRegion(void) {
-        std::string local_optstr = "DFO Starting Trust Region";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFOStartingTrustRegion).rvalue;
       }
 
       // DFO Trust Region Slow Tol:
@@ -504,14 +745,7 @@ namespace nagcpp {
         return DFOTrustRegionSlowTol(value, local_opt);
       }
       double get_DFOTrustRegionSlowTol(void) {
-        std::string local_optstr = "DFO Trust Region Slow Tol";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFOTrustRegionSlowTol).rvalue;
       }
 
       // DFO Trust Region Tolerance:
@@ -529,14 +763,7 @@ namespace nagcpp {
         return DFOTrustRegionTolerance(value, local_opt);
       }
       double get_DFOTrustRegionTolerance(void) {
-        std::string local_optstr = "DFO Trust Region Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::DFOTrustRegionTolerance).rvalue;
       }
 
       // DIMACS Measures:
@@ -555,14 +782,7 @@ namespace nagcpp {
         return DIMACSMeasures(value, local_opt);
       }
       std::string get_DIMACSMeasures(void) {
-        std::string local_optstr = "DIMACS Measures";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::DIMACSMeasures).cvalue;
       }
 
       // Defaults:
@@ -594,14 +814,7 @@ namespace nagcpp {
         return FOASEstimateDerivatives(value, local_opt);
       }
       std::string get_FOASEstimateDerivatives(void) {
-        std::string local_optstr = "FOAS Estimate Derivatives";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::FOASEstimateDerivatives).cvalue;
       }
 
       // FOAS Finite Diff Interval:
@@ -619,14 +832,7 @@ namespace nagcpp {
         return FOASFiniteDiffInterval(value, local_opt);
       }
       double get_FOASFiniteDiffInterval(void) {
-        std::string local_optstr = "FOAS Finite Diff Interval";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASFiniteDiffInterval).rvalue;
       }
 
       // FOAS Iteration Limit:
@@ -645,14 +851,7 @@ namespace nagcpp {
         return FOASIterationLimit(value, local_opt);
       }
       types::f77_integer get_FOASIterationLimit(void) {
-        std::string local_optstr = "FOAS Iteration Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::FOASIterationLimit).ivalue;
       }
 
       // FOAS Memory:
@@ -669,14 +868,7 @@ namespace nagcpp {
         return FOASMemory(value, local_opt);
       }
       types::f77_integer get_FOASMemory(void) {
-        std::string local_optstr = "FOAS Memory";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::FOASMemory).ivalue;
       }
 
       // FOAS Monitor Frequency:
@@ -695,14 +887,7 @@ namespace nagcpp {
         return FOASMonitorFrequency(value, local_opt);
       }
       types::f77_integer get_FOASMonitorFrequency(void) {
-        std::string local_optstr = "FOAS Monitor Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::FOASMonitorFrequency).ivalue;
       }
 
       // FOAS Print Frequency:
@@ -721,14 +906,7 @@ namespace nagcpp {
         return FOASPrintFrequency(value, local_opt);
       }
       types::f77_integer get_FOASPrintFrequency(void) {
-        std::string local_optstr = "FOAS Print Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::FOASPrintFrequency).ivalue;
       }
 
       // FOAS Progress Tolerance:
@@ -747,14 +925,7 @@ namespace nagcpp {
         return FOASProgressTolerance(value, local_opt);
       }
       double get_FOASProgressTolerance(void) {
-        std::string local_optstr = "FOAS Progress Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASProgressTolerance).rvalue;
       }
 
       // FOAS Rel Stop Tolerance:
@@ -773,14 +944,7 @@ namespace nagcpp {
         return FOASRelStopTolerance(value, local_opt);
       }
       double get_FOASRelStopTolerance(void) {
-        std::string local_optstr = "FOAS Rel Stop Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASRelStopTolerance).rvalue;
       }
 
       // FOAS Restart Factor:
@@ -799,14 +963,7 @@ namespace nagcpp {
         return FOASRestartFactor(value, local_opt);
       }
       double get_FOASRestartFactor(void) {
-        std::string local_optstr = "FOAS Restart Factor";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASRestartFactor).rvalue;
       }
 
       // FOAS Slow Tolerance:
@@ -824,14 +981,7 @@ namespace nagcpp {
         return FOASSlowTolerance(value, local_opt);
       }
       double get_FOASSlowTolerance(void) {
-        std::string local_optstr = "FOAS Slow Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASSlowTolerance).rvalue;
       }
 
       // FOAS Stop Tolerance:
@@ -850,14 +1000,7 @@ namespace nagcpp {
         return FOASStopTolerance(value, local_opt);
       }
       double get_FOASStopTolerance(void) {
-        std::string local_optstr = "FOAS Stop Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::FOASStopTolerance).rvalue;
       }
 
       // FOAS Tolerance Norm:
@@ -875,14 +1018,7 @@ namespace nagcpp {
         return FOASToleranceNorm(value, local_opt);
       }
       std::string get_FOASToleranceNorm(void) {
-        std::string local_optstr = "FOAS Tolerance Norm";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::FOASToleranceNorm).cvalue;
       }
 
       // Hessian Density:
@@ -900,14 +1036,7 @@ namespace nagcpp {
         return HessianDensity(value, local_opt);
       }
       std::string get_HessianDensity(void) {
-        std::string local_optstr = "Hessian Density";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::HessianDensity).cvalue;
       }
 
       // Hessian Mode:
@@ -925,14 +1054,7 @@ namespace nagcpp {
         return HessianMode(value, local_opt);
       }
       std::string get_HessianMode(void) {
-        std::string local_optstr = "Hessian Mode";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::HessianMode).cvalue;
       }
 
       // Infinite Bound Size:
@@ -950,14 +1072,7 @@ namespace nagcpp {
         return InfiniteBoundSize(value, local_opt);
       }
       double get_InfiniteBoundSize(void) {
-        std::string local_optstr = "Infinite Bound Size";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InfiniteBoundSize).rvalue;
       }
 
       // Init Value P:
@@ -974,14 +1089,7 @@ namespace nagcpp {
         return InitValueP(value, local_opt);
       }
       double get_InitValueP(void) {
-        std::string local_optstr = "Init Value P";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InitValueP).rvalue;
       }
 
       // Init Value Pmat:
@@ -999,14 +1107,7 @@ namespace nagcpp {
         return InitValuePmat(value, local_opt);
       }
       double get_InitValuePmat(void) {
-        std::string local_optstr = "Init Value Pmat";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InitValuePmat).rvalue;
       }
 
       // Initial P:
@@ -1023,14 +1124,7 @@ namespace nagcpp {
         return InitialP(value, local_opt);
       }
       std::string get_InitialP(void) {
-        std::string local_optstr = "Initial P";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::InitialP).cvalue;
       }
 
       // Initial U:
@@ -1047,14 +1141,7 @@ namespace nagcpp {
         return InitialU(value, local_opt);
       }
       std::string get_InitialU(void) {
-        std::string local_optstr = "Initial U";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::InitialU).cvalue;
       }
 
       // Initial Value Ubox:
@@ -1071,14 +1158,7 @@ namespace nagcpp {
         return InitialValueUbox(value, local_opt);
       }
       double get_InitialValueUbox(void) {
-        std::string local_optstr = "Initial Value Ubox";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InitialValueUbox).rvalue;
       }
 
       // Initial Value Ulin:
@@ -1095,14 +1175,7 @@ namespace nagcpp {
         return InitialValueUlin(value, local_opt);
       }
       double get_InitialValueUlin(void) {
-        std::string local_optstr = "Initial Value Ulin";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InitialValueUlin).rvalue;
       }
 
       // Initial Value Unln:
@@ -1119,14 +1192,7 @@ namespace nagcpp {
         return InitialValueUnln(value, local_opt);
       }
       double get_InitialValueUnln(void) {
-        std::string local_optstr = "Initial Value Unln";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InitialValueUnln).rvalue;
       }
 
       // Initial X:
@@ -1142,14 +1208,7 @@ namespace nagcpp {
         return InitialX(value, local_opt);
       }
       std::string get_InitialX(void) {
-        std::string local_optstr = "Initial X";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::InitialX).cvalue;
       }
 
       // Inner Iteration Limit:
@@ -1168,14 +1227,7 @@ namespace nagcpp {
         return InnerIterationLimit(value, local_opt);
       }
       types::f77_integer get_InnerIterationLimit(void) {
-        std::string local_optstr = "Inner Iteration Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::InnerIterationLimit).ivalue;
       }
 
       // Inner Stop Criteria:
@@ -1194,14 +1246,7 @@ namespace nagcpp {
         return InnerStopCriteria(value, local_opt);
       }
       std::string get_InnerStopCriteria(void) {
-        std::string local_optstr = "Inner Stop Criteria";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::InnerStopCriteria).cvalue;
       }
 
       // Inner Stop Tolerance:
@@ -1219,14 +1264,7 @@ namespace nagcpp {
         return InnerStopTolerance(value, local_opt);
       }
       double get_InnerStopTolerance(void) {
-        std::string local_optstr = "Inner Stop Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::InnerStopTolerance).rvalue;
       }
 
       // LPIPM Algorithm:
@@ -1246,14 +1284,7 @@ namespace nagcpp {
         return LPIPMAlgorithm(value, local_opt);
       }
       std::string get_LPIPMAlgorithm(void) {
-        std::string local_optstr = "LPIPM Algorithm";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::LPIPMAlgorithm).cvalue;
       }
 
       // LPIPM Centrality Correctors:
@@ -1272,14 +1303,7 @@ namespace nagcpp {
         return LPIPMCentralityCorrectors(value, local_opt);
       }
       types::f77_integer get_LPIPMCentralityCorrectors(void) {
-        std::string local_optstr = "LPIPM Centrality Correctors";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::LPIPMCentralityCorrectors).ivalue;
       }
 
       // LPIPM Iteration Limit:
@@ -1298,14 +1322,7 @@ namespace nagcpp {
         return LPIPMIterationLimit(value, local_opt);
       }
       types::f77_integer get_LPIPMIterationLimit(void) {
-        std::string local_optstr = "LPIPM Iteration Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::LPIPMIterationLimit).ivalue;
       }
 
       // LPIPM Max Iterative Refinement:
@@ -1325,14 +1342,7 @@ namespace nagcpp {
         return LPIPMMaxIterativeRefinement(value, local_opt);
       }
       types::f77_integer get_LPIPMMaxIterativeRefinement(void) {
-        std::string local_optstr = "LPIPM Max Iterative Refinement";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::LPIPMMaxIterativeRefinement).ivalue;
       }
 
       // LPIPM Monitor Frequency:
@@ -1350,14 +1360,7 @@ namespace nagcpp {
         return LPIPMMonitorFrequency(value, local_opt);
       }
       types::f77_integer get_LPIPMMonitorFrequency(void) {
-        std::string local_optstr = "LPIPM Monitor Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::LPIPMMonitorFrequency).ivalue;
       }
 
       // LPIPM Scaling:
@@ -1374,14 +1377,7 @@ namespace nagcpp {
         return LPIPMScaling(value, local_opt);
       }
       std::string get_LPIPMScaling(void) {
-        std::string local_optstr = "LPIPM Scaling";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::LPIPMScaling).cvalue;
       }
 
       // LPIPM Stop Tolerance:
@@ -1399,14 +1395,7 @@ namespace nagcpp {
         return LPIPMStopTolerance(value, local_opt);
       }
       double get_LPIPMStopTolerance(void) {
-        std::string local_optstr = "LPIPM Stop Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::LPIPMStopTolerance).rvalue;
       }
 
       // LPIPM Stop Tolerance 2:
@@ -1424,14 +1413,7 @@ namespace nagcpp {
         return LPIPMStopTolerance2(value, local_opt);
       }
       double get_LPIPMStopTolerance2(void) {
-        std::string local_optstr = "LPIPM Stop Tolerance 2";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::LPIPMStopTolerance2).rvalue;
       }
 
       // LPIPM System Formulation:
@@ -1451,14 +1433,7 @@ namespace nagcpp {
         return LPIPMSystemFormulation(value, local_opt);
       }
       std::string get_LPIPMSystemFormulation(void) {
-        std::string local_optstr = "LPIPM System Formulation";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::LPIPMSystemFormulation).cvalue;
       }
 
       // LP Presolve:
@@ -1475,14 +1450,7 @@ namespace nagcpp {
         return LPPresolve(value, local_opt);
       }
       std::string get_LPPresolve(void) {
-        std::string local_optstr = "LP Presolve";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::LPPresolve).cvalue;
       }
 
       // Linesearch Mode:
@@ -1499,14 +1467,7 @@ namespace nagcpp {
         return LinesearchMode(value, local_opt);
       }
       std::string get_LinesearchMode(void) {
-        std::string local_optstr = "Linesearch Mode";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::LinesearchMode).cvalue;
       }
 
       // List:
@@ -1523,14 +1484,7 @@ namespace nagcpp {
         return List(value, local_opt);
       }
       std::string get_List(void) {
-        std::string local_optstr = "List";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::List).cvalue;
       }
 
       // Matrix Ordering:
@@ -1548,14 +1502,7 @@ namespace nagcpp {
         return MatrixOrdering(value, local_opt);
       }
       std::string get_MatrixOrdering(void) {
-        std::string local_optstr = "Matrix Ordering";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::MatrixOrdering).cvalue;
       }
 
       // Monitor Frequency:
@@ -1574,14 +1521,7 @@ namespace nagcpp {
         return MonitorFrequency(value, local_opt);
       }
       types::f77_integer get_MonitorFrequency(void) {
-        std::string local_optstr = "Monitor Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::MonitorFrequency).ivalue;
       }
 
       // Monitoring File:
@@ -1599,14 +1539,7 @@ namespace nagcpp {
         return MonitoringFile(value, local_opt);
       }
       types::f77_integer get_MonitoringFile(void) {
-        std::string local_optstr = "Monitoring File";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::MonitoringFile).ivalue;
       }
 
       // Monitoring Level:
@@ -1625,14 +1558,7 @@ namespace nagcpp {
         return MonitoringLevel(value, local_opt);
       }
       types::f77_integer get_MonitoringLevel(void) {
-        std::string local_optstr = "Monitoring Level";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::MonitoringLevel).ivalue;
       }
 
       // NLP Factorization Method:
@@ -1651,14 +1577,7 @@ namespace nagcpp {
         return NLPFactorizationMethod(value, local_opt);
       }
       std::string get_NLPFactorizationMethod(void) {
-        std::string local_optstr = "NLP Factorization Method";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::NLPFactorizationMethod).cvalue;
       }
 
       // Outer Iteration Limit:
@@ -1677,14 +1596,7 @@ namespace nagcpp {
         return OuterIterationLimit(value, local_opt);
       }
       types::f77_integer get_OuterIterationLimit(void) {
-        std::string local_optstr = "Outer Iteration Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::OuterIterationLimit).ivalue;
       }
 
       // P Min:
@@ -1701,14 +1613,7 @@ namespace nagcpp {
         return PMin(value, local_opt);
       }
       double get_PMin(void) {
-        std::string local_optstr = "P Min";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::PMin).rvalue;
       }
 
       // P Update Speed:
@@ -1727,14 +1632,7 @@ namespace nagcpp {
         return PUpdateSpeed(value, local_opt);
       }
       types::f77_integer get_PUpdateSpeed(void) {
-        std::string local_optstr = "P Update Speed";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::PUpdateSpeed).ivalue;
       }
 
       // Pmat Min:
@@ -1750,14 +1648,7 @@ namespace nagcpp {
         return PmatMin(value, local_opt);
       }
       double get_PmatMin(void) {
-        std::string local_optstr = "Pmat Min";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::PmatMin).rvalue;
       }
 
       // Preference:
@@ -1774,14 +1665,7 @@ namespace nagcpp {
         return Preference(value, local_opt);
       }
       std::string get_Preference(void) {
-        std::string local_optstr = "Preference";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::Preference).cvalue;
       }
 
       // Presolve Block Detect:
@@ -1801,14 +1685,7 @@ namespace nagcpp {
         return PresolveBlockDetect(value, local_opt);
       }
       std::string get_PresolveBlockDetect(void) {
-        std::string local_optstr = "Presolve Block Detect";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::PresolveBlockDetect).cvalue;
       }
 
       // Print File:
@@ -1824,14 +1701,7 @@ namespace nagcpp {
         return PrintFile(value, local_opt);
       }
       types::f77_integer get_PrintFile(void) {
-        std::string local_optstr = "Print File";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::PrintFile).ivalue;
       }
 
       // Print Level:
@@ -1848,14 +1718,7 @@ namespace nagcpp {
         return PrintLevel(value, local_opt);
       }
       types::f77_integer get_PrintLevel(void) {
-        std::string local_optstr = "Print Level";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::PrintLevel).ivalue;
       }
 
       // Print Options:
@@ -1872,14 +1735,7 @@ namespace nagcpp {
         return PrintOptions(value, local_opt);
       }
       std::string get_PrintOptions(void) {
-        std::string local_optstr = "Print Options";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::PrintOptions).cvalue;
       }
 
       // Print Solution:
@@ -1896,14 +1752,7 @@ namespace nagcpp {
         return PrintSolution(value, local_opt);
       }
       std::string get_PrintSolution(void) {
-        std::string local_optstr = "Print Solution";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::PrintSolution).cvalue;
       }
 
       // SOCP Factorization Method:
@@ -1923,14 +1772,7 @@ namespace nagcpp {
         return SOCPFactorizationMethod(value, local_opt);
       }
       std::string get_SOCPFactorizationMethod(void) {
-        std::string local_optstr = "SOCP Factorization Method";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::SOCPFactorizationMethod).cvalue;
       }
 
       // SOCP Iteration Limit:
@@ -1949,14 +1791,7 @@ namespace nagcpp {
         return SOCPIterationLimit(value, local_opt);
       }
       types::f77_integer get_SOCPIterationLimit(void) {
-        std::string local_optstr = "SOCP Iteration Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::SOCPIterationLimit).ivalue;
       }
 
       // SOCP Monitor Frequency:
@@ -1974,14 +1809,7 @@ namespace nagcpp {
         return SOCPMonitorFrequency(value, local_opt);
       }
       types::f77_integer get_SOCPMonitorFrequency(void) {
-        std::string local_optstr = "SOCP Monitor Frequency";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_ivalue;
+        return get_option(Option::SOCPMonitorFrequency).ivalue;
       }
 
       // SOCP Presolve:
@@ -1998,14 +1826,7 @@ namespace nagcpp {
         return SOCPPresolve(value, local_opt);
       }
       std::string get_SOCPPresolve(void) {
-        std::string local_optstr = "SOCP Presolve";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::SOCPPresolve).cvalue;
       }
 
       // SOCP Scaling:
@@ -2022,14 +1843,7 @@ namespace nagcpp {
         return SOCPScaling(value, local_opt);
       }
       std::string get_SOCPScaling(void) {
-        std::string local_optstr = "SOCP Scaling";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::SOCPScaling).cvalue;
       }
 
       // SOCP Stop Tolerance:
@@ -2047,14 +1861,7 @@ namespace nagcpp {
         return SOCPStopTolerance(value, local_opt);
       }
       double get_SOCPStopTolerance(void) {
-        std::string local_optstr = "SOCP Stop Tolerance";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::SOCPStopTolerance).rvalue;
       }
 
       // SOCP Stop Tolerance 2:
@@ -2072,14 +1879,7 @@ namespace nagcpp {
         return SOCPStopTolerance2(value, local_opt);
       }
       double get_SOCPStopTolerance2(void) {
-        std::string local_optstr = "SOCP Stop Tolerance 2";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::SOCPStopTolerance2).rvalue;
       }
 
       // SOCP System Formulation:
@@ -2099,14 +1899,7 @@ namespace nagcpp {
         return SOCPSystemFormulation(value, local_opt);
       }
       std::string get_SOCPSystemFormulation(void) {
-        std::string local_optstr = "SOCP System Formulation";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::SOCPSystemFormulation).cvalue;
       }
 
       // Stats Time:
@@ -2123,14 +1916,7 @@ namespace nagcpp {
         return StatsTime(value, local_opt);
       }
       std::string get_StatsTime(void) {
-        std::string local_optstr = "Stats Time";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::StatsTime).cvalue;
       }
 
       // Stop Criteria:
@@ -2148,14 +1934,7 @@ namespace nagcpp {
         return StopCriteria(value, local_opt);
       }
       std::string get_StopCriteria(void) {
-        std::string local_optstr = "Stop Criteria";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::StopCriteria).cvalue;
       }
 
       // Stop Tolerance 1:
@@ -2173,14 +1952,7 @@ namespace nagcpp {
         return StopTolerance1(value, local_opt);
       }
       double get_StopTolerance1(void) {
-        std::string local_optstr = "Stop Tolerance 1";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::StopTolerance1).rvalue;
       }
 
       // Stop Tolerance 2:
@@ -2199,14 +1971,7 @@ namespace nagcpp {
         return StopTolerance2(value, local_opt);
       }
       double get_StopTolerance2(void) {
-        std::string local_optstr = "Stop Tolerance 2";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::StopTolerance2).rvalue;
       }
 
       // Stop Tolerance Feasibility:
@@ -2225,14 +1990,7 @@ namespace nagcpp {
         return StopToleranceFeasibility(value, local_opt);
       }
       double get_StopToleranceFeasibility(void) {
-        std::string local_optstr = "Stop Tolerance Feasibility";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::StopToleranceFeasibility).rvalue;
       }
 
       // Task:
@@ -2248,14 +2006,7 @@ namespace nagcpp {
         return Task(value, local_opt);
       }
       std::string get_Task(void) {
-        std::string local_optstr = "Task";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::Task).cvalue;
       }
 
       // Time Limit:
@@ -2272,14 +2023,7 @@ namespace nagcpp {
         return TimeLimit(value, local_opt);
       }
       double get_TimeLimit(void) {
-        std::string local_optstr = "Time Limit";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::TimeLimit).rvalue;
       }
 
       // Transform Constraints:
@@ -2297,14 +2041,7 @@ namespace nagcpp {
         return TransformConstraints(value, local_opt);
       }
       std::string get_TransformConstraints(void) {
-        std::string local_optstr = "Transform Constraints";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::TransformConstraints).cvalue;
       }
 
       // U Update Restriction:
@@ -2322,14 +2059,7 @@ namespace nagcpp {
         return UUpdateRestriction(value, local_opt);
       }
       double get_UUpdateRestriction(void) {
-        std::string local_optstr = "U Update Restriction";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::UUpdateRestriction).rvalue;
       }
 
       // Umat Update Restriction:
@@ -2347,14 +2077,7 @@ namespace nagcpp {
         return UmatUpdateRestriction(value, local_opt);
       }
       double get_UmatUpdateRestriction(void) {
-        std::string local_optstr = "Umat Update Restriction";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_rvalue;
+        return get_option(Option::UmatUpdateRestriction).rvalue;
       }
 
       // Verify Derivatives:
@@ -2372,14 +2095,7 @@ namespace nagcpp {
         return VerifyDerivatives(value, local_opt);
       }
       std::string get_VerifyDerivatives(void) {
-        std::string local_optstr = "Verify Derivatives";
-        types::f77_integer local_ivalue;
-        double local_rvalue;
-        std::string local_cvalue;
-        types::f77_integer local_optype;
-        handle_opt_get((*this), local_optstr, local_ivalue, local_rvalue,
-                       local_cvalue, local_optype);
-        return local_cvalue;
+        return get_option(Option::VerifyDerivatives).cvalue;
       }
     };
   }
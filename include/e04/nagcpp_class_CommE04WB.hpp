@@ -7,10 +7,12 @@
 #ifndef NAGCPP_COMME04WB
 #define NAGCPP_COMME04WB
 
+#include "e04/nagcpp_e04_options.hpp"
 #include "e04/nagcpp_e04ue.hpp"
 #include "e04/nagcpp_e04wb.hpp"
 #include "utility/nagcpp_utility_comm.hpp"
 #include "utility/nagcpp_utility_functions.hpp"
+#include <initializer_list>
 
 namespace nagcpp {
   namespace opt {
@@ -24,6 +26,16 @@ namespace nagcpp {
         nlp1_init(rname, (*this));
       }
       ~CommE04WB() {}
+      CommE04WB(const CommE04WB &) = default;
+      CommE04WB &operator=(const CommE04WB &) = default;
+      CommE04WB(CommE04WB &&) = default;
+      CommE04WB &operator=(CommE04WB &&) = default;
+      // copy-on-write copy, see utility::CopyableComm::snapshot
+      CommE04WB(const CommE04WB &from, snapshot_tag)
+        : CopyableComm(from, snapshot_tag()) {}
+      CommE04WB snapshot(void) const {
+        return CommE04WB(*this, snapshot_tag());
+      }
       CommE04WB &set(const std::string str, opt::OptionalE04UE &opt) {
         nlp1_option_string(str, (*this), opt);
         return (*this);
@@ -32,6 +44,51 @@ namespace nagcpp {
         nlp1_option_string(str, (*this));
         return (*this);
       }
+      // set an option via its descriptor in opt::e04ue_options, e.g.
+      // comm.set(opt::e04ue_options::MajorPrintLevel, 1)
+      template <typename T, typename V>
+      CommE04WB &set(const utility::OptionDescriptor<CommE04WB, T> &option,
+                     const V &value, opt::OptionalE04UE &opt) {
+        nlp1_option_string(utility::set_optstr(option, value), (*this), opt);
+        return (*this);
+      }
+      template <typename T, typename V>
+      CommE04WB &set(const utility::OptionDescriptor<CommE04WB, T> &option,
+                     const V &value) {
+        opt::OptionalE04UE local_opt;
+        return set(option, value, local_opt);
+      }
+      CommE04WB &
+        set(const utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+              &option,
+            opt::OptionalE04UE &opt) {
+        nlp1_option_string(utility::set_optstr(option), (*this), opt);
+        return (*this);
+      }
+      CommE04WB &
+        set(const utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+              &option) {
+        opt::OptionalE04UE local_opt;
+        return set(option, local_opt);
+      }
+      // apply a number of option settings, each via nlp1_option_string
+      // (e04ue), stopping at the first invalid setting
+      CommE04WB &set_options(
+        std::initializer_list<utility::OptionSetting<CommE04WB>> settings,
+        opt::OptionalE04UE &opt) {
+        for (const auto &setting : settings) {
+          nlp1_option_string(setting.str(), (*this), opt);
+          if (opt.fail.error_thrown) {
+            break;
+          }
+        }
+        return (*this);
+      }
+      CommE04WB &set_options(
+        std::initializer_list<utility::OptionSetting<CommE04WB>> settings) {
+        opt::OptionalE04UE local_opt;
+        return set_options(settings, local_opt);
+      }
 
       // Central Difference Interval:
       //   Default values are computed
@@ -0,0 +1,354 @@
+// Header for the model template class used to create multiple
+// nagcpp::opt::CommE04RA handles holding the same problem definition
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_MODELE04RA
+#define NAGCPP_MODELE04RA
+
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "e04/nagcpp_e04re.hpp"
+#include "e04/nagcpp_e04rf.hpp"
+#include "e04/nagcpp_e04rg.hpp"
+#include "e04/nagcpp_e04rh.hpp"
+#include "e04/nagcpp_e04rj.hpp"
+#include "e04/nagcpp_e04rk.hpp"
+#include "e04/nagcpp_e04rl.hpp"
+#include "e04/nagcpp_e04rm.hpp"
+#include "e04/nagcpp_e04zm.hpp"
+#include "utility/nagcpp_data_handling.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include "utility/nagcpp_utility_functions.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nagcpp {
+  namespace opt {
+    // ModelE04RA
+    // Records the definition of a problem for the NAG optimization modelling
+    // suite (the calls to the opt::handle_set_* routines and any option
+    // settings) so that it can be replayed into any number of independent
+    // opt::CommE04RA handles.
+    // The engine has no routine for copying a handle, so a new handle is
+    // still populated via the same sequence of opt::handle_set_* calls, but
+    // the arrays defining the model are only assembled (and validated) once,
+    // when the model is recorded, and are passed directly to the engine on
+    // each replay.
+    // Each call is applied to an internal handle when it is recorded, so any
+    // errors are raised (and any output values returned) at that point, in
+    // exactly the same way as a direct call to the underlying routine.
+    // Once a handle has been created from the model it is independent of the
+    // model, and can be modified (for example, by changing the bounds via
+    // opt::handle_set_simplebounds (e04rh) or an individual linear
+    // constraint via opt::handle_set_linconstr (e04rj) with opt.idlc > 0)
+    // without affecting the model or any other handle created from it.
+    class ModelE04RA {
+    private:
+      template <typename T>
+      struct RecordedArray {
+        bool present;
+        std::vector<T> values;
+      };
+      using Step = std::function<void(CommE04RA &)>;
+
+      types::f77_integer nvar;
+      CommE04RA prototype;
+      std::vector<Step> steps;
+
+      // take a copy of an array supplied to one of the opt::handle_set_*
+      // routines (called after the routine has successfully been applied
+      // to the prototype, so the array is known to be valid)
+      template <typename RT, typename A>
+      static RecordedArray<RT> record_array(const A &a) {
+        data_handling::RawData<RT, data_handling::ArgIntent::IntentIN,
+                               typename std::remove_reference<A>::type>
+          local_a(a);
+        RecordedArray<RT> recorded;
+        recorded.present = static_cast<bool>(local_a.data);
+        if (recorded.present) {
+          error_handler::ErrorHandler fail;
+          types::f77_integer n = data_handling::get_size(fail, "a", local_a, 1);
+          recorded.values.assign(local_a.data, local_a.data + n);
+        }
+        return recorded;
+      }
+      // view of a recorded array, suitable for passing back to the
+      // opt::handle_set_* routines
+      template <typename RT>
+      static utility::array1D<RT, data_handling::ArgIntent::IntentIN>
+        view(const RecordedArray<RT> &recorded) {
+        return utility::array1D<RT, data_handling::ArgIntent::IntentIN>(
+          recorded.present ? recorded.values.data() : nullptr,
+          recorded.values.size());
+      }
+
+    public:
+      ModelE04RA(const types::f77_integer nvar_, opt::OptionalE04RA &opt)
+        : nvar(nvar_), prototype(nvar_, opt) {}
+      ModelE04RA(const types::f77_integer nvar_)
+        : nvar(nvar_), prototype(nvar_) {}
+      ModelE04RA(const ModelE04RA &) = delete;
+      ModelE04RA &operator=(const ModelE04RA &) = delete;
+
+      types::f77_integer get_nvar(void) const { return nvar; }
+      // number of recorded calls
+      size_t size(void) const { return steps.size(); }
+
+      // record a call to opt::handle_set_linobj (e04re)
+      template <typename CVEC>
+      ModelE04RA &set_linobj(const CVEC &cvec, opt::OptionalE04RE &opt) {
+        handle_set_linobj(prototype, cvec, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rcvec = record_array<double>(cvec);
+        steps.push_back([rcvec](CommE04RA &comm) {
+          handle_set_linobj(comm, view(rcvec));
+        });
+        return (*this);
+      }
+      template <typename CVEC>
+      ModelE04RA &set_linobj(const CVEC &cvec) {
+        opt::OptionalE04RE local_opt;
+        return set_linobj(cvec, local_opt);
+      }
+
+      // record a call to opt::handle_set_quadobj (e04rf)
+      template <typename IDXC, typename C, typename IROWH, typename ICOLH,
+                typename H>
+      ModelE04RA &set_quadobj(const IDXC &idxc, const C &c, const IROWH &irowh,
+                              const ICOLH &icolh, const H &h,
+                              opt::OptionalE04RF &opt) {
+        handle_set_quadobj(prototype, idxc, c, irowh, icolh, h, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto ridxc = record_array<types::f77_integer>(idxc);
+        auto rc = record_array<double>(c);
+        auto rirowh = record_array<types::f77_integer>(irowh);
+        auto ricolh = record_array<types::f77_integer>(icolh);
+        auto rh = record_array<double>(h);
+        steps.push_back([ridxc, rc, rirowh, ricolh, rh](CommE04RA &comm) {
+          handle_set_quadobj(comm, view(ridxc), view(rc), view(rirowh),
+                             view(ricolh), view(rh));
+        });
+        return (*this);
+      }
+      template <typename IDXC, typename C, typename IROWH, typename ICOLH,
+                typename H>
+      ModelE04RA &set_quadobj(const IDXC &idxc, const C &c, const IROWH &irowh,
+                              const ICOLH &icolh, const H &h) {
+        opt::OptionalE04RF local_opt;
+        return set_quadobj(idxc, c, irowh, icolh, h, local_opt);
+      }
+
+      // record a call to opt::handle_set_nlnobj (e04rg)
+      template <typename IDXFD>
+      ModelE04RA &set_nlnobj(const IDXFD &idxfd, opt::OptionalE04RG &opt) {
+        handle_set_nlnobj(prototype, idxfd, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto ridxfd = record_array<types::f77_integer>(idxfd);
+        steps.push_back([ridxfd](CommE04RA &comm) {
+          handle_set_nlnobj(comm, view(ridxfd));
+        });
+        return (*this);
+      }
+      template <typename IDXFD>
+      ModelE04RA &set_nlnobj(const IDXFD &idxfd) {
+        opt::OptionalE04RG local_opt;
+        return set_nlnobj(idxfd, local_opt);
+      }
+
+      // record a call to opt::handle_set_simplebounds (e04rh)
+      template <typename BL, typename BU>
+      ModelE04RA &set_simplebounds(const BL &bl, const BU &bu,
+                                   opt::OptionalE04RH &opt) {
+        handle_set_simplebounds(prototype, bl, bu, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rbl = record_array<double>(bl);
+        auto rbu = record_array<double>(bu);
+        steps.push_back([rbl, rbu](CommE04RA &comm) {
+          handle_set_simplebounds(comm, view(rbl), view(rbu));
+        });
+        return (*this);
+      }
+      template <typename BL, typename BU>
+      ModelE04RA &set_simplebounds(const BL &bl, const BU &bu) {
+        opt::OptionalE04RH local_opt;
+        return set_simplebounds(bl, bu, local_opt);
+      }
+
+      // record a call to opt::handle_set_linconstr (e04rj)
+      template <typename BL, typename BU, typename IROWB, typename ICOLB,
+                typename B>
+      ModelE04RA &set_linconstr(const BL &bl, const BU &bu, const IROWB &irowb,
+                                const ICOLB &icolb, const B &b,
+                                opt::OptionalE04RJ &opt) {
+        types::f77_integer idlc = opt.get_idlc();
+        handle_set_linconstr(prototype, bl, bu, irowb, icolb, b, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rbl = record_array<double>(bl);
+        auto rbu = record_array<double>(bu);
+        auto rirowb = record_array<types::f77_integer>(irowb);
+        auto ricolb = record_array<types::f77_integer>(icolb);
+        auto rb = record_array<double>(b);
+        steps.push_back([idlc, rbl, rbu, rirowb, ricolb, rb](CommE04RA &comm) {
+          opt::OptionalE04RJ local_opt;
+          local_opt.idlc(idlc);
+          handle_set_linconstr(comm, view(rbl), view(rbu), view(rirowb),
+                               view(ricolb), view(rb), local_opt);
+        });
+        return (*this);
+      }
+      template <typename BL, typename BU, typename IROWB, typename ICOLB,
+                typename B>
+      ModelE04RA &set_linconstr(const BL &bl, const BU &bu, const IROWB &irowb,
+                                const ICOLB &icolb, const B &b) {
+        opt::OptionalE04RJ local_opt;
+        return set_linconstr(bl, bu, irowb, icolb, b, local_opt);
+      }
+
+      // record a call to opt::handle_set_nlnconstr (e04rk)
+      template <typename BL, typename BU, typename IROWGD, typename ICOLGD>
+      ModelE04RA &set_nlnconstr(const BL &bl, const BU &bu,
+                                const IROWGD &irowgd, const ICOLGD &icolgd,
+                                opt::OptionalE04RK &opt) {
+        handle_set_nlnconstr(prototype, bl, bu, irowgd, icolgd, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rbl = record_array<double>(bl);
+        auto rbu = record_array<double>(bu);
+        auto rirowgd = record_array<types::f77_integer>(irowgd);
+        auto ricolgd = record_array<types::f77_integer>(icolgd);
+        steps.push_back([rbl, rbu, rirowgd, ricolgd](CommE04RA &comm) {
+          handle_set_nlnconstr(comm, view(rbl), view(rbu), view(rirowgd),
+                               view(ricolgd));
+        });
+        return (*this);
+      }
+      template <typename BL, typename BU, typename IROWGD, typename ICOLGD>
+      ModelE04RA &set_nlnconstr(const BL &bl, const BU &bu,
+                                const IROWGD &irowgd, const ICOLGD &icolgd) {
+        opt::OptionalE04RK local_opt;
+        return set_nlnconstr(bl, bu, irowgd, icolgd, local_opt);
+      }
+
+      // record a call to opt::handle_set_nlnhess (e04rl)
+      template <typename IROWH, typename ICOLH>
+      ModelE04RA &set_nlnhess(const types::f77_integer idf, const IROWH &irowh,
+                              const ICOLH &icolh, opt::OptionalE04RL &opt) {
+        handle_set_nlnhess(prototype, idf, irowh, icolh, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rirowh = record_array<types::f77_integer>(irowh);
+        auto ricolh = record_array<types::f77_integer>(icolh);
+        steps.push_back([idf, rirowh, ricolh](CommE04RA &comm) {
+          handle_set_nlnhess(comm, idf, view(rirowh), view(ricolh));
+        });
+        return (*this);
+      }
+      template <typename IROWH, typename ICOLH>
+      ModelE04RA &set_nlnhess(const types::f77_integer idf, const IROWH &irowh,
+                              const ICOLH &icolh) {
+        opt::OptionalE04RL local_opt;
+        return set_nlnhess(idf, irowh, icolh, local_opt);
+      }
+
+      // record a call to opt::handle_set_nlnls (e04rm)
+      template <typename IROWRD, typename ICOLRD>
+      ModelE04RA &set_nlnls(const types::f77_integer nres,
+                            const IROWRD &irowrd, const ICOLRD &icolrd,
+                            opt::OptionalE04RM &opt) {
+        handle_set_nlnls(prototype, nres, irowrd, icolrd, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        auto rirowrd = record_array<types::f77_integer>(irowrd);
+        auto ricolrd = record_array<types::f77_integer>(icolrd);
+        steps.push_back([nres, rirowrd, ricolrd](CommE04RA &comm) {
+          handle_set_nlnls(comm, nres, view(rirowrd), view(ricolrd));
+        });
+        return (*this);
+      }
+      template <typename IROWRD, typename ICOLRD>
+      ModelE04RA &set_nlnls(const types::f77_integer nres,
+                            const IROWRD &irowrd, const ICOLRD &icolrd) {
+        opt::OptionalE04RM local_opt;
+        return set_nlnls(nres, irowrd, icolrd, local_opt);
+      }
+
+      // record a call to opt::handle_opt_set (e04zm)
+      ModelE04RA &set(const std::string optstr, opt::OptionalE04ZM &opt) {
+        handle_opt_set(prototype, optstr, opt);
+        if (opt.fail.error_thrown) {
+          return (*this);
+        }
+        steps.push_back(
+          [optstr](CommE04RA &comm) { handle_opt_set(comm, optstr); });
+        return (*this);
+      }
+      ModelE04RA &set(const std::string optstr) {
+        opt::OptionalE04ZM local_opt;
+        return set(optstr, local_opt);
+      }
+      // record a call to opt::handle_opt_set (e04zm) for the named option,
+      // equivalent to the named option setters in opt::CommE04RA
+      template <typename T>
+      ModelE04RA &set(const std::string name, T value,
+                      opt::OptionalE04ZM &opt) {
+        return set(utility::set_optstr(name, value), opt);
+      }
+      template <typename T>
+      ModelE04RA &set(const std::string name, T value) {
+        opt::OptionalE04ZM local_opt;
+        return set(name, value, local_opt);
+      }
+      // record a call to opt::handle_opt_set (e04zm) for an option
+      // descriptor from opt::e04zm_options
+      template <typename T, typename V>
+      ModelE04RA &set(const utility::OptionDescriptor<CommE04RA, T> &option,
+                      const V &value) {
+        return set(utility::set_optstr(option, value));
+      }
+      ModelE04RA &
+        set(const utility::OptionDescriptor<CommE04RA, utility::OptionKeyword>
+              &option) {
+        return set(utility::set_optstr(option));
+      }
+
+      // replay the recorded calls into comm, which must have been
+      // initialized via opt::handle_init (e04ra) with nvar variables and
+      // not had any part of the problem defined
+      void apply(CommE04RA &comm) const {
+        for (const auto &step : steps) {
+          step(comm);
+        }
+      }
+      // create a new handle holding the recorded model
+      std::unique_ptr<CommE04RA> create(void) const {
+        std::unique_ptr<CommE04RA> comm(new CommE04RA(nvar));
+        apply(*comm);
+        return comm;
+      }
+      // create n new handles holding the recorded model
+      std::vector<std::unique_ptr<CommE04RA>> create(size_t n) const {
+        std::vector<std::unique_ptr<CommE04RA>> comms;
+        comms.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+          comms.push_back(create());
+        }
+        return comms;
+      }
+    };
+  }
+}
+#endif
@@ -0,0 +1,384 @@
+// Header for nagcpp::opt::ObjectiveEvaluationCache and
+// nagcpp::opt::ConstraintEvaluationCache
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_E04_EVAL_CACHE_HPP
+#define NAGCPP_E04_EVAL_CACHE_HPP
+
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace nagcpp {
+  namespace opt {
+    // ObjectiveEvaluationCache, ConstraintEvaluationCache
+    // Memoizing callback adaptors for solvers that evaluate a function and
+    // its derivatives through separate callbacks (or separate calls of the
+    // same callback), typically at the same point: for example objfun then
+    // objgrd in opt::handle_solve_ipopt (e04st) or
+    // opt::handle_solve_bounds_foas (e04kf), or mode = 0 then mode = 1 in
+    // opt::nlp1_solve (e04uc).
+    // The user supplies a single function that returns the value and the
+    // derivatives together, this is called whenever one of the adaptor
+    // callbacks is invoked at a point that differs from the last point
+    // evaluated, otherwise the cached results are returned. Points are
+    // compared bitwise, so the cache is only hit when the solver passes
+    // exactly the same x.
+    // Calls to the adaptors are serialized, so they can be used from more
+    // than one thread, but there is no benefit in doing so.
+
+    // ObjectiveEvaluationCache(objfg, nnzfd)
+    // parameters:
+    //   objfg: void, function
+    //     Calculates the value and the gradient of the objective function
+    //     objfg(x, fx, fdx, inform)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //         x, the vector of variable values at which the objective
+    //         function and its gradient are to be evaluated
+    //       fx: double, scalar
+    //         On exit: the value of the objective function at x
+    //       fdx: utility::vector_view<double>, shape(nnzfd)
+    //         On exit: the nonzero elements of the gradient at x
+    //       inform: types::f77_integer, scalar
+    //         On exit: a negative value indicates that the function could
+    //         not be evaluated, this is passed back to the solver and the
+    //         results are not cached
+    //   nnzfd: types::f77_integer, scalar
+    //     The number of nonzeros in the gradient (nvar if the gradient is
+    //     dense, or as supplied to opt::handle_set_nlnobj (e04rg))
+
+    // ConstraintEvaluationCache(confg, ncnln, nnzgd)
+    // parameters:
+    //   confg: void, function
+    //     Calculates the values and the Jacobian of the constraint functions
+    //     confg(x, ncnln, gx, gdx, inform)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //       ncnln: types::f77_integer, scalar
+    //       gx: utility::vector_view<double>, shape(ncnln)
+    //         On exit: the values of the constraint functions at x
+    //       gdx: utility::vector_view<double>, shape(nnzgd)
+    //         On exit: the nonzero elements of the Jacobian at x, in the
+    //         order supplied to opt::handle_set_nlnconstr (e04rk)
+    //       inform: types::f77_integer, scalar
+    //         as for ObjectiveEvaluationCache
+    //   ncnln: types::f77_integer, scalar
+    //     m_g, the number of nonlinear constraints
+    //   nnzgd: types::f77_integer, scalar
+    //     The number of nonzeros in the Jacobian
+
+    // adaptors (passed to the solver in place of the callbacks):
+    //   ObjectiveEvaluationCache::objfun(), objgrd()
+    //     objfun(x, fx, inform) and objgrd(x, fdx, inform) callbacks, as
+    //     used by opt::handle_solve_bounds_foas (e04kf) and
+    //     opt::handle_solve_ipopt (e04st)
+    //   ObjectiveEvaluationCache::nlp1_objfun()
+    //     objfun(mode, x, objf, objgrd, nstate) callback, as used by
+    //     opt::nlp1_solve (e04uc), which requires nnzfd = n
+    //   ConstraintEvaluationCache::confun(), congrd()
+    //     confun(x, ncnln, gx, inform) and congrd(x, gdx, inform) callbacks,
+    //     as used by opt::handle_solve_ipopt (e04st)
+    // the adaptors refer to the cache, which must therefore outlive the
+    // solve
+
+    // counters:
+    //   get_nhits(): the number of adaptor calls served from the cache
+    //   get_nmisses(): the number of adaptor calls that required an
+    //     evaluation
+    //   clear(): empties the cache and resets both counters
+
+    namespace internal {
+      // single point cache shared by the objective and constraint caches
+      // and by the fused e04kf cache below
+      class EvaluationCacheBase {
+      private:
+        std::vector<double> xc;
+        bool valid;
+        size_t nhits;
+        size_t nmisses;
+
+      protected:
+        std::mutex mtx;
+
+        EvaluationCacheBase() : valid(false), nhits(0), nmisses(0) {}
+        // returns true if x is the cached point, otherwise x becomes the
+        // cached point, which is marked as invalid until set_valid is called
+        // (so that an evaluation that throws cannot leave stale results
+        // cached against x)
+        bool move_to(const utility::vector_view<const double> &x) {
+          size_t n = x.size();
+          if (valid && xc.size() == n &&
+              (n == 0 ||
+               std::memcmp(xc.data(), x.data(), n * sizeof(double)) == 0)) {
+            return true;
+          }
+          valid = false;
+          xc.assign(x.begin(), x.end());
+          return false;
+        }
+        // as move_to, and updates the counters
+        bool lookup(const utility::vector_view<const double> &x) {
+          bool hit = move_to(x);
+          count(hit);
+          return hit;
+        }
+        void count(bool hit) {
+          if (hit) {
+            ++nhits;
+          } else {
+            ++nmisses;
+          }
+        }
+        void set_valid(bool value) { valid = value; }
+
+      public:
+        EvaluationCacheBase(const EvaluationCacheBase &) = delete;
+        EvaluationCacheBase &operator=(const EvaluationCacheBase &) = delete;
+        size_t get_nhits(void) {
+          std::lock_guard<std::mutex> lock(mtx);
+          return nhits;
+        }
+        size_t get_nmisses(void) {
+          std::lock_guard<std::mutex> lock(mtx);
+          return nmisses;
+        }
+        void clear(void) {
+          std::lock_guard<std::mutex> lock(mtx);
+          valid = false;
+          nhits = 0;
+          nmisses = 0;
+        }
+      };
+
+      // cache used to route the objfun and objgrd callbacks of a solver
+      // through a single fused callback, objfg, that can be asked for the
+      // objective, the gradient or both (see the fused version of
+      // opt::handle_solve_bounds_foas (e04kf))
+      // unlike ObjectiveEvaluationCache, the value and the gradient at the
+      // cached point are held (and requested from objfg) separately
+      template <typename OBJFG>
+      class FusedObjectiveEvaluationCache : public EvaluationCacheBase {
+      private:
+        OBJFG &objfg;
+        double fx_cached;
+        std::vector<double> fdx_cached;
+        bool have_f;
+        bool have_g;
+
+        void evaluate(const utility::vector_view<const double> &x,
+                      bool need_f, bool need_g, types::f77_integer &inform) {
+          // the cached results are invalid until objfg has returned, and
+          // if need_f is false objfg can reuse its results from x
+          set_valid(false);
+          utility::vector_view<double> fdxv(fdx_cached.data(),
+                                            fdx_cached.size());
+          objfg(x, fx_cached, fdxv, need_f, need_g, inform);
+          if (inform < 0) {
+            have_f = have_g = false;
+            return;
+          }
+          have_f = have_f || need_f;
+          have_g = have_g || need_g;
+          set_valid(true);
+        }
+
+      public:
+        FusedObjectiveEvaluationCache(OBJFG &objfg_)
+          : objfg(objfg_), fx_cached(0.0), have_f(false), have_g(false) {}
+        void objfun(const utility::vector_view<const double> &x, double &fx,
+                    types::f77_integer &inform) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (!move_to(x)) {
+            have_f = have_g = false;
+          }
+          count(have_f);
+          if (!have_f) {
+            evaluate(x, true, false, inform);
+          }
+          if (have_f) {
+            fx = fx_cached;
+          }
+        }
+        void objgrd(const utility::vector_view<const double> &x,
+                    utility::vector_view<double> &fdx,
+                    types::f77_integer &inform) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (fdx_cached.size() != fdx.size()) {
+            fdx_cached.resize(fdx.size());
+            have_g = false;
+          }
+          if (!move_to(x)) {
+            // most likely to be followed by a request for the function
+            // value at the same point, so ask for both
+            have_f = have_g = false;
+            count(false);
+            evaluate(x, true, true, inform);
+          } else {
+            count(have_g);
+            if (!have_g) {
+              evaluate(x, !have_f, true, inform);
+            }
+          }
+          if (have_g) {
+            std::copy(fdx_cached.begin(), fdx_cached.end(), fdx.begin());
+          }
+        }
+      };
+    }
+
+    template <typename OBJFG>
+    class ObjectiveEvaluationCache : public internal::EvaluationCacheBase {
+    private:
+      OBJFG objfg;
+      double fx_cached;
+      std::vector<double> fdx_cached;
+
+      // evaluate at x (if required) and copy the requested results
+      void get(const utility::vector_view<const double> &x, double *fx,
+               double *fdx, types::f77_integer &inform) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!lookup(x)) {
+          utility::vector_view<double> fdxv(fdx_cached.data(),
+                                            fdx_cached.size());
+          types::f77_integer linform = 0;
+          objfg(x, fx_cached, fdxv, linform);
+          set_valid(linform >= 0);
+          if (linform < 0) {
+            inform = linform;
+            return;
+          }
+        }
+        if (fx) {
+          *fx = fx_cached;
+        }
+        if (fdx) {
+          std::copy(fdx_cached.begin(), fdx_cached.end(), fdx);
+        }
+      }
+
+    public:
+      ObjectiveEvaluationCache(OBJFG objfg_, const types::f77_integer nnzfd)
+        : objfg(objfg_), fx_cached(0.0),
+          fdx_cached(static_cast<size_t>(nnzfd), 0.0) {}
+
+      class ObjfunAdaptor {
+      private:
+        ObjectiveEvaluationCache *cache;
+
+      public:
+        ObjfunAdaptor(ObjectiveEvaluationCache *cache_) : cache(cache_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        double &fx, types::f77_integer &inform) {
+          cache->get(x, &fx, nullptr, inform);
+        }
+      };
+      class ObjgrdAdaptor {
+      private:
+        ObjectiveEvaluationCache *cache;
+
+      public:
+        ObjgrdAdaptor(ObjectiveEvaluationCache *cache_) : cache(cache_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        utility::vector_view<double> &fdx,
+                        types::f77_integer &inform) {
+          cache->get(x, nullptr, fdx.data(), inform);
+        }
+      };
+      class Nlp1ObjfunAdaptor {
+      private:
+        ObjectiveEvaluationCache *cache;
+
+      public:
+        Nlp1ObjfunAdaptor(ObjectiveEvaluationCache *cache_) : cache(cache_) {}
+        void operator()(const types::f77_integer mode,
+                        const utility::vector_view<const double> &x,
+                        double &objf, utility::vector_view<double> &objgrd,
+                        const types::f77_integer nstate) {
+          // e04uc has no way of reporting a failed evaluation via this
+          // interface
+          types::f77_integer inform = 0;
+          cache->get(x, (mode != 1) ? &objf : nullptr,
+                     (mode != 0) ? objgrd.data() : nullptr, inform);
+        }
+      };
+
+      ObjfunAdaptor objfun(void) { return ObjfunAdaptor(this); }
+      ObjgrdAdaptor objgrd(void) { return ObjgrdAdaptor(this); }
+      Nlp1ObjfunAdaptor nlp1_objfun(void) { return Nlp1ObjfunAdaptor(this); }
+    };
+
+    template <typename CONFG>
+    class ConstraintEvaluationCache : public internal::EvaluationCacheBase {
+    private:
+      CONFG confg;
+      types::f77_integer ncnln;
+      std::vector<double> gx_cached;
+      std::vector<double> gdx_cached;
+
+      void get(const utility::vector_view<const double> &x, double *gx,
+               double *gdx, types::f77_integer &inform) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!lookup(x)) {
+          utility::vector_view<double> gxv(gx_cached.data(), gx_cached.size());
+          utility::vector_view<double> gdxv(gdx_cached.data(),
+                                            gdx_cached.size());
+          types::f77_integer linform = 0;
+          confg(x, ncnln, gxv, gdxv, linform);
+          set_valid(linform >= 0);
+          if (linform < 0) {
+            inform = linform;
+            return;
+          }
+        }
+        if (gx) {
+          std::copy(gx_cached.begin(), gx_cached.end(), gx);
+        }
+        if (gdx) {
+          std::copy(gdx_cached.begin(), gdx_cached.end(), gdx);
+        }
+      }
+
+    public:
+      ConstraintEvaluationCache(CONFG confg_, const types::f77_integer ncnln_,
+                                const types::f77_integer nnzgd)
+        : confg(confg_), ncnln(ncnln_),
+          gx_cached(static_cast<size_t>(ncnln_), 0.0),
+          gdx_cached(static_cast<size_t>(nnzgd), 0.0) {}
+
+      class ConfunAdaptor {
+      private:
+        ConstraintEvaluationCache *cache;
+
+      public:
+        ConfunAdaptor(ConstraintEvaluationCache *cache_) : cache(cache_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        const types::f77_integer ncnln,
+                        utility::vector_view<double> &gx,
+                        types::f77_integer &inform) {
+          cache->get(x, gx.data(), nullptr, inform);
+        }
+      };
+      class CongrdAdaptor {
+      private:
+        ConstraintEvaluationCache *cache;
+
+      public:
+        CongrdAdaptor(ConstraintEvaluationCache *cache_) : cache(cache_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        utility::vector_view<double> &gdx,
+                        types::f77_integer &inform) {
+          cache->get(x, nullptr, gdx.data(), inform);
+        }
+      };
+
+      ConfunAdaptor confun(void) { return ConfunAdaptor(this); }
+      CongrdAdaptor congrd(void) { return CongrdAdaptor(this); }
+    };
+  }
+}
+#endif
@@ -0,0 +1,434 @@
+// Header for nagcpp::opt::FDObjectiveGradient and
+// nagcpp::opt::FDConstraintJacobian
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_E04_FD_GRADIENT_HPP
+#define NAGCPP_E04_FD_GRADIENT_HPP
+
+#include "utility/nagcpp_data_handling.hpp"
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_error_handler.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace nagcpp {
+  namespace opt {
+    // FDObjectiveGradient, FDConstraintJacobian
+    // Finite difference approximations to the sparse objective gradient and
+    // constraint Jacobian of a problem defined via the NAG optimization
+    // modelling suite, suitable for passing as the objgrd and congrd
+    // callbacks of the handle solvers (for example,
+    // opt::handle_solve_bounds_foas (e04kf) or opt::handle_solve_ipopt
+    // (e04st)). The function evaluations required for each gradient are
+    // spread over opt.nthreads threads. The additional threads are started
+    // the first time the gradient is evaluated and reused for every
+    // subsequent evaluation (see utility::ThreadPool), copies of an object
+    // share its threads.
+    // For the objective, each element of the gradient requires its own
+    // evaluation of objfun. For the constraints, the columns of the Jacobian
+    // are partitioned into groups such that no two columns in a group have
+    // a nonzero in the same row (a greedy colouring of the column
+    // intersection graph), and all columns in a group are perturbed at the
+    // same time, so one evaluation of confun is required per group rather
+    // than per variable.
+
+    // FDObjectiveGradient(objfun, idxfd, opt)
+    // parameters:
+    //   objfun: void, function
+    //     objfun must calculate the value of the nonlinear objective function
+    //     f(x), with the same signature as the objfun callback of the solver
+    //     objfun(x, fx, inform)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //         x, the vector of variable values at which the objective
+    //         function is to be evaluated
+    //       fx: double, scalar
+    //         On exit: the value of the objective function at x
+    //       inform: types::f77_integer, scalar
+    //         On exit: a negative value indicates that the function could
+    //         not be evaluated, this is passed back to the solver
+    //     objfun is called concurrently from up to opt.nthreads threads
+    //   idxfd: types::f77_integer, array, shape(nnzfd)
+    //     The sparsity pattern of the objective gradient, as supplied to
+    //     opt::handle_set_nlnobj (e04rg). An empty array indicates a dense
+    //     gradient (nnzfd = nvar)
+    //   opt: opt::OptionalFDGradient
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       nthreads: int, scalar
+    //         The number of threads used to evaluate the objective
+    //         (values <= 0 use std::thread::hardware_concurrency threads)
+    //         default value: 1
+    //       step: double, scalar
+    //         The relative difference interval, variable x_j is perturbed by
+    //         step * (1 + |x_j|)
+    //         default value: sqrt(machine precision)
+    //       central: bool, scalar
+    //         If true, central rather than forward differences are used,
+    //         doubling the number of function evaluations
+    //         default value: false
+    //       fail: error_handler::ErrorHandler
+
+    // FDConstraintJacobian(confun, ncnln, irowgd, icolgd, opt)
+    // parameters:
+    //   confun: void, function
+    //     confun must calculate the values of the nonlinear constraint
+    //     functions g(x), with the same signature as the confun callback of
+    //     opt::handle_solve_ipopt (e04st)
+    //     confun(x, ncnln, gx, inform)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //         x, the vector of variable values at which the constraint
+    //         functions are to be evaluated
+    //       ncnln: types::f77_integer, scalar
+    //         m_g, the number of nonlinear constraints
+    //       gx: utility::vector_view<double>, shape(ncnln)
+    //         On exit: the values of the constraint functions at x
+    //       inform: types::f77_integer, scalar
+    //         On exit: a negative value indicates that the functions could
+    //         not be evaluated, this is passed back to the solver
+    //     confun is called concurrently from up to opt.nthreads threads
+    //   ncnln: types::f77_integer, scalar
+    //     m_g, the number of nonlinear constraints
+    //   irowgd: types::f77_integer, array, shape(nnzgd)
+    //   icolgd: types::f77_integer, array, shape(nnzgd)
+    //     The sparsity pattern of the constraint Jacobian, as supplied to
+    //     opt::handle_set_nlnconstr (e04rk)
+    //   opt: opt::OptionalFDGradient
+    //     as for FDObjectiveGradient
+
+    // error_handler::ErrorException
+    //   (errorid 10601)
+    //     On entry, argument icolgd must be a vector of size nnzgd
+
+    // as the indices in idxfd, irowgd and icolgd are not checked beyond
+    // their sizes, they must be the arrays that were supplied to (and
+    // accepted by) opt::handle_set_nlnobj (e04rg) and
+    // opt::handle_set_nlnconstr (e04rk)
+
+    class OptionalFDGradient : public utility::Optional {
+    private:
+      int nthreads_value;
+      double step_value;
+      bool central_value;
+
+    public:
+      OptionalFDGradient()
+        : Optional(), nthreads_value(1),
+          step_value(std::sqrt(std::numeric_limits<double>::epsilon())),
+          central_value(false) {}
+      OptionalFDGradient &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
+      OptionalFDGradient &step(double value) {
+        step_value = value;
+        return (*this);
+      }
+      double get_step(void) { return step_value; }
+      OptionalFDGradient &central(bool value) {
+        central_value = value;
+        return (*this);
+      }
+      bool get_central(void) { return central_value; }
+      template <typename OBJFUN>
+      friend class FDObjectiveGradient;
+      template <typename CONFUN>
+      friend class FDConstraintJacobian;
+    };
+
+    namespace internal {
+      // record the first negative inform returned by a callback
+      inline void fd_record_inform(std::atomic<types::f77_integer> &fail,
+                                   types::f77_integer inform) {
+        if (inform < 0) {
+          types::f77_integer expected = 0;
+          fail.compare_exchange_strong(expected, inform);
+        }
+      }
+      // perturbation used for variable xj (the actual difference between
+      // the perturbed and unperturbed values is returned in h)
+      inline double fd_perturb(double xj, double step, double &h) {
+        double xp = xj + step * (1.0 + std::abs(xj));
+        h = xp - xj;
+        return xp;
+      }
+    }
+
+    template <typename OBJFUN>
+    class FDObjectiveGradient {
+    private:
+      OBJFUN objfun;
+      // zero based indices of the variables in the gradient
+      std::vector<size_t> idxfd;
+      // (shared by any copies of this object)
+      std::shared_ptr<utility::ThreadPool> pool;
+      double step;
+      bool central;
+
+      template <typename IDXFD>
+      void init(const IDXFD &idxfd_, opt::OptionalFDGradient &opt) {
+        opt.fail.prepare("opt::FDObjectiveGradient");
+        pool = std::make_shared<utility::ThreadPool>(opt.nthreads_value);
+        step = opt.step_value;
+        central = opt.central_value;
+        for (auto idx : idxfd_) {
+          idxfd.push_back(static_cast<size_t>(idx - 1));
+        }
+      }
+
+    public:
+      template <typename IDXFD>
+      FDObjectiveGradient(OBJFUN objfun_, const IDXFD &idxfd_,
+                          opt::OptionalFDGradient &opt)
+        : objfun(objfun_) {
+        init(idxfd_, opt);
+      }
+      // alt-1
+      template <typename IDXFD>
+      FDObjectiveGradient(OBJFUN objfun_, const IDXFD &idxfd_)
+        : objfun(objfun_) {
+        opt::OptionalFDGradient local_opt;
+        init(idxfd_, local_opt);
+      }
+
+      // objgrd callback
+      void operator()(const utility::vector_view<const double> &x,
+                      utility::vector_view<double> &fdx,
+                      types::f77_integer &inform) {
+        size_t nvar = x.size();
+        size_t nnzfd = fdx.size();
+
+        double f0 = 0.0;
+        if (!central) {
+          objfun(x, f0, inform);
+          if (inform < 0) {
+            return;
+          }
+        }
+
+        std::atomic<types::f77_integer> fail(0);
+        pool->parallel_for(nnzfd, [&](size_t begin, size_t end, size_t) {
+          // each thread perturbs its own copy of x
+          std::vector<double> xp(x.begin(), x.end());
+          utility::vector_view<const double> xpv(xp.data(), nvar);
+          for (size_t k = begin; k < end && fail.load() == 0; ++k) {
+            size_t j = idxfd.empty() ? k : idxfd[k];
+            double h;
+            xp[j] = internal::fd_perturb(x[j], step, h);
+            double fp = 0.0;
+            types::f77_integer linform = 0;
+            objfun(xpv, fp, linform);
+            if (central && linform >= 0) {
+              xp[j] = x[j] - h;
+              double fm = 0.0;
+              objfun(xpv, fm, linform);
+              fdx[k] = (fp - fm) / (2.0 * h);
+            } else {
+              fdx[k] = (fp - f0) / h;
+            }
+            xp[j] = x[j];
+            internal::fd_record_inform(fail, linform);
+          }
+        });
+        if (fail.load() < 0) {
+          inform = fail.load();
+        }
+      }
+    };
+
+    template <typename CONFUN>
+    class FDConstraintJacobian {
+    private:
+      CONFUN confun;
+      types::f77_integer ncnln;
+      // zero based row index of each nonzero
+      std::vector<size_t> irowgd;
+      // columns in each group ...
+      std::vector<std::vector<size_t>> groups;
+      // ... and the nonzeros in each column
+      std::vector<std::vector<size_t>> colnz;
+      // (shared by any copies of this object)
+      std::shared_ptr<utility::ThreadPool> pool;
+      double step;
+      bool central;
+
+      void colour_columns(const std::vector<size_t> &icolgd) {
+        size_t nnzgd = icolgd.size();
+        size_t ncol = 0;
+        size_t nrow = 0;
+        for (size_t k = 0; k < nnzgd; ++k) {
+          ncol = std::max(ncol, icolgd[k] + 1);
+          nrow = std::max(nrow, irowgd[k] + 1);
+        }
+        colnz.assign(ncol, std::vector<size_t>());
+        std::vector<std::vector<size_t>> rowcols(nrow);
+        for (size_t k = 0; k < nnzgd; ++k) {
+          colnz[icolgd[k]].push_back(k);
+          rowcols[irowgd[k]].push_back(icolgd[k]);
+        }
+
+        // largest first ordering, so the densest columns are coloured
+        // while the most colours are still available
+        std::vector<size_t> order(ncol);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) {
+                           return colnz[a].size() > colnz[b].size();
+                         });
+
+        const size_t none = std::numeric_limits<size_t>::max();
+        std::vector<size_t> colour(ncol, none);
+        // forbidden[c] == j if colour c is used by a neighbour of column j
+        std::vector<size_t> forbidden;
+        for (size_t j : order) {
+          if (colnz[j].empty()) {
+            continue;
+          }
+          for (size_t k : colnz[j]) {
+            for (size_t jj : rowcols[irowgd[k]]) {
+              if (colour[jj] != none) {
+                forbidden[colour[jj]] = j;
+              }
+            }
+          }
+          size_t c = 0;
+          while (c < forbidden.size() && forbidden[c] == j) {
+            ++c;
+          }
+          if (c == forbidden.size()) {
+            forbidden.push_back(none);
+            groups.push_back(std::vector<size_t>());
+          }
+          colour[j] = c;
+          groups[c].push_back(j);
+        }
+      }
+
+      template <typename IROWGD, typename ICOLGD>
+      void init(const IROWGD &irowgd_, const ICOLGD &icolgd_,
+                opt::OptionalFDGradient &opt) {
+        opt.fail.prepare("opt::FDConstraintJacobian");
+        utility::ScopedWorkspaceAllocator local_allocator_scope(
+          opt.workspace_allocator.get());
+        pool = std::make_shared<utility::ThreadPool>(opt.nthreads_value);
+        step = opt.step_value;
+        central = opt.central_value;
+        data_handling::RawData<types::f77_integer,
+                               data_handling::ArgIntent::IntentIN,
+                               typename std::remove_reference<IROWGD>::type>
+          local_irowgd(irowgd_);
+        data_handling::RawData<types::f77_integer,
+                               data_handling::ArgIntent::IntentIN,
+                               typename std::remove_reference<ICOLGD>::type>
+          local_icolgd(icolgd_);
+        types::f77_integer local_nnzgd =
+          data_handling::get_size(opt.fail, "nnzgd", local_irowgd, 1);
+        if (opt.fail.error_thrown) {
+          return;
+        }
+        local_icolgd.check(opt.fail, "icolgd", true, local_nnzgd);
+        if (opt.fail.error_thrown) {
+          return;
+        }
+
+        size_t nnzgd = static_cast<size_t>(local_nnzgd);
+        std::vector<size_t> icolgd(nnzgd);
+        irowgd.resize(nnzgd);
+        for (size_t k = 0; k < nnzgd; ++k) {
+          irowgd[k] = static_cast<size_t>(local_irowgd.data[k] - 1);
+          icolgd[k] = static_cast<size_t>(local_icolgd.data[k] - 1);
+        }
+        colour_columns(icolgd);
+      }
+
+    public:
+      template <typename IROWGD, typename ICOLGD>
+      FDConstraintJacobian(CONFUN confun_, const types::f77_integer ncnln_,
+                           const IROWGD &irowgd_, const ICOLGD &icolgd_,
+                           opt::OptionalFDGradient &opt)
+        : confun(confun_), ncnln(ncnln_) {
+        init(irowgd_, icolgd_, opt);
+      }
+      // alt-1
+      template <typename IROWGD, typename ICOLGD>
+      FDConstraintJacobian(CONFUN confun_, const types::f77_integer ncnln_,
+                           const IROWGD &irowgd_, const ICOLGD &icolgd_)
+        : confun(confun_), ncnln(ncnln_) {
+        opt::OptionalFDGradient local_opt;
+        init(irowgd_, icolgd_, local_opt);
+      }
+
+      // number of confun evaluations needed for each Jacobian (in addition
+      // to the one at the unperturbed point for forward differences)
+      size_t ngroups(void) const { return groups.size(); }
+
+      // congrd callback
+      void operator()(const utility::vector_view<const double> &x,
+                      utility::vector_view<double> &gdx,
+                      types::f77_integer &inform) {
+        size_t nvar = x.size();
+        size_t m = static_cast<size_t>(ncnln);
+
+        std::vector<double> g0(m, 0.0);
+        if (!central) {
+          utility::vector_view<double> g0v(g0.data(), m);
+          confun(x, ncnln, g0v, inform);
+          if (inform < 0) {
+            return;
+          }
+        }
+
+        std::atomic<types::f77_integer> fail(0);
+        pool->parallel_for(
+          groups.size(), [&](size_t begin, size_t end, size_t) {
+            std::vector<double> xp(x.begin(), x.end());
+            std::vector<double> h(nvar, 0.0);
+            std::vector<double> gp(m, 0.0), gm(m, 0.0);
+            utility::vector_view<const double> xpv(xp.data(), nvar);
+            utility::vector_view<double> gpv(gp.data(), m);
+            utility::vector_view<double> gmv(gm.data(), m);
+            for (size_t ig = begin; ig < end && fail.load() == 0; ++ig) {
+              const std::vector<size_t> &group = groups[ig];
+              for (size_t j : group) {
+                xp[j] = internal::fd_perturb(x[j], step, h[j]);
+              }
+              types::f77_integer linform = 0;
+              confun(xpv, ncnln, gpv, linform);
+              if (central && linform >= 0) {
+                for (size_t j : group) {
+                  xp[j] = x[j] - h[j];
+                }
+                confun(xpv, ncnln, gmv, linform);
+              }
+              // the columns in a group have no rows in common, so each row
+              // of gp is affected by at most one of the perturbations
+              for (size_t j : group) {
+                for (size_t k : colnz[j]) {
+                  size_t r = irowgd[k];
+                  gdx[k] = central ? (gp[r] - gm[r]) / (2.0 * h[j])
+                                   : (gp[r] - g0[r]) / h[j];
+                }
+                xp[j] = x[j];
+              }
+              internal::fd_record_inform(fail, linform);
+            }
+          });
+        if (fail.load() < 0) {
+          inform = fail.load();
+        }
+      }
+    };
+  }
+}
+#endif
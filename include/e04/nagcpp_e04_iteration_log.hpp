@@ -0,0 +1,242 @@
+// Header for nagcpp::opt::IterationLog
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_E04_ITERATION_LOG_HPP
+#define NAGCPP_E04_ITERATION_LOG_HPP
+
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_error_handler.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nagcpp {
+  namespace opt {
+    // IterationLog
+    // In-memory record of the progress of one of the handle solvers, built
+    // from the rinfo and stats arrays passed to the monit callback at the
+    // end of each iteration. Each selected element of rinfo or stats is
+    // stored as a column (one double per iteration), so the log can be
+    // inspected, or written to CSV or a simple binary format, after the
+    // solve without having to parse the printed iteration log.
+
+    // IterationLog(columns, capacity)
+    // IterationLog(capacity)
+    // parameters:
+    //   columns: std::vector<IterationLog::Column>
+    //     The elements to record, each given by
+    //       name: std::string
+    //         The column name, used by column() and in the exported file
+    //       source: IterationLog::Source (RINFO or STATS)
+    //         The array the element is taken from
+    //       index: size_t
+    //         The (zero-based) index into that array
+    //     If not supplied, all 100 elements of rinfo and stats are recorded,
+    //     in columns named rinfo_0, ..., rinfo_99, stats_0, ..., stats_99
+    //   capacity: size_t
+    //     The number of iterations to preallocate storage for. The log
+    //     grows beyond this if required
+
+    // adaptors (passed to the solver as the monit callback):
+    //   IterationLog::foas_monit()
+    //     monit(x, rinfo, stats), as used by
+    //     opt::handle_solve_bounds_foas (e04kf)
+    //   IterationLog::ipopt_monit()
+    //     monit(x, u, rinfo, stats), as used by opt::handle_solve_ipopt (e04st)
+    //   IterationLog::ipm_monit()
+    //     monit(comm, rinfo, stats), as used by opt::handle_solve_lp_ipm
+    //     (e04mt) and opt::handle_solve_socp_ipm (e04pt)
+    // the adaptors refer to the log, which must therefore outlive the solve.
+    // Note that the monit callback is only called if the solver option
+    // "Monitoring Frequency" (or equivalent) is positive.
+
+    // other methods:
+    //   append(rinfo, stats): adds an iteration to the log
+    //   nrows(): the number of iterations recorded
+    //   ncolumns(): the number of columns
+    //   names(): the column names
+    //   column(name), column(j): the values in a column, throws
+    //     error_handler::ErrorException if there is no such column
+    //   clear(): removes all iterations, keeping the columns
+    //   write_csv(os): writes a header line of column names followed by one
+    //     line per iteration
+    //   write_binary(os): writes
+    //       ncolumns, nrows: std::uint64_t
+    //       for each column: name length (std::uint64_t), name characters
+    //       for each column: nrows doubles
+    //     in the native byte order
+
+    class IterationLog {
+    public:
+      enum class Source { RINFO, STATS };
+      struct Column {
+        std::string name;
+        Source source;
+        size_t index;
+      };
+
+    private:
+      static const size_t array_length = 100;
+      std::vector<Column> columns;
+      std::vector<std::vector<double>> values;
+
+      static void raise_error(const std::string &msg) {
+        throw error_handler::ErrorException(
+          "IterationLog", msg, error_handler::ErrorType::GeneralError,
+          error_handler::IERR_VALUE_NOT_AVAILABLE,
+          error_handler::IERR_VALUE_NOT_AVAILABLE,
+          error_handler::IERR_VALUE_ERROR_IFMT);
+      }
+      void init(const size_t capacity) {
+        for (const auto &col : columns) {
+          if (col.index >= array_length) {
+            raise_error("The index of column " + col.name +
+                        " must be less than " + std::to_string(array_length) +
+                        ".");
+          }
+        }
+        values.assign(columns.size(), std::vector<double>());
+        for (auto &vals : values) {
+          vals.reserve(capacity);
+        }
+      }
+
+    public:
+      IterationLog(const std::vector<Column> &columns_,
+                   const size_t capacity = 1000)
+        : columns(columns_) {
+        init(capacity);
+      }
+      IterationLog(const size_t capacity = 1000) {
+        for (size_t i = 0; i < array_length; ++i) {
+          columns.push_back({"rinfo_" + std::to_string(i), Source::RINFO, i});
+        }
+        for (size_t i = 0; i < array_length; ++i) {
+          columns.push_back({"stats_" + std::to_string(i), Source::STATS, i});
+        }
+        init(capacity);
+      }
+
+      void append(const double *rinfo, const double *stats) {
+        for (size_t j = 0; j < columns.size(); ++j) {
+          const double *src =
+            (columns[j].source == Source::RINFO) ? rinfo : stats;
+          values[j].push_back(src[columns[j].index]);
+        }
+      }
+      size_t nrows(void) const {
+        return values.empty() ? 0 : values[0].size();
+      }
+      size_t ncolumns(void) const { return columns.size(); }
+      std::vector<std::string> names(void) const {
+        std::vector<std::string> result;
+        for (const auto &col : columns) {
+          result.push_back(col.name);
+        }
+        return result;
+      }
+      const std::vector<double> &column(const size_t j) const {
+        if (j >= columns.size()) {
+          raise_error("Column " + std::to_string(j) +
+                      " does not exist, the log has " +
+                      std::to_string(columns.size()) + " columns.");
+        }
+        return values[j];
+      }
+      const std::vector<double> &column(const std::string &name) const {
+        for (size_t j = 0; j < columns.size(); ++j) {
+          if (columns[j].name == name) {
+            return values[j];
+          }
+        }
+        raise_error("Column " + name + " does not exist.");
+        return values[0];
+      }
+      void clear(void) {
+        for (auto &vals : values) {
+          vals.clear();
+        }
+      }
+
+      void write_csv(std::ostream &os) const {
+        std::streamsize precision = os.precision();
+        os << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (size_t j = 0; j < columns.size(); ++j) {
+          os << (j ? "," : "") << columns[j].name;
+        }
+        os << "\n";
+        for (size_t i = 0; i < nrows(); ++i) {
+          for (size_t j = 0; j < columns.size(); ++j) {
+            os << (j ? "," : "") << values[j][i];
+          }
+          os << "\n";
+        }
+        os << std::setprecision(precision);
+      }
+      void write_binary(std::ostream &os) const {
+        std::uint64_t header[2] = {static_cast<std::uint64_t>(ncolumns()),
+                                   static_cast<std::uint64_t>(nrows())};
+        os.write(reinterpret_cast<const char *>(header), sizeof(header));
+        for (const auto &col : columns) {
+          std::uint64_t length = static_cast<std::uint64_t>(col.name.size());
+          os.write(reinterpret_cast<const char *>(&length), sizeof(length));
+          os.write(col.name.data(),
+                   static_cast<std::streamsize>(col.name.size()));
+        }
+        for (const auto &vals : values) {
+          os.write(reinterpret_cast<const char *>(vals.data()),
+                   static_cast<std::streamsize>(vals.size() * sizeof(double)));
+        }
+      }
+
+      class FoasMonitAdaptor {
+      private:
+        IterationLog *log;
+
+      public:
+        FoasMonitAdaptor(IterationLog *log_) : log(log_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        const utility::vector_view<const double> &rinfo,
+                        const utility::vector_view<const double> &stats) {
+          log->append(rinfo.data(), stats.data());
+        }
+      };
+      class IpoptMonitAdaptor {
+      private:
+        IterationLog *log;
+
+      public:
+        IpoptMonitAdaptor(IterationLog *log_) : log(log_) {}
+        void operator()(const utility::vector_view<const double> &x,
+                        const utility::vector_view<const double> &u,
+                        const utility::vector_view<const double> &rinfo,
+                        const utility::vector_view<const double> &stats) {
+          log->append(rinfo.data(), stats.data());
+        }
+      };
+      class IpmMonitAdaptor {
+      private:
+        IterationLog *log;
+
+      public:
+        IpmMonitAdaptor(IterationLog *log_) : log(log_) {}
+        void operator()(opt::CommE04RA &comm,
+                        const utility::vector_view<const double> &rinfo,
+                        const utility::vector_view<const double> &stats) {
+          log->append(rinfo.data(), stats.data());
+        }
+      };
+
+      FoasMonitAdaptor foas_monit(void) { return FoasMonitAdaptor(this); }
+      IpoptMonitAdaptor ipopt_monit(void) { return IpoptMonitAdaptor(this); }
+      IpmMonitAdaptor ipm_monit(void) { return IpmMonitAdaptor(this); }
+    };
+  }
+}
+#endif
@@ -0,0 +1,248 @@
+// Header for nagcpp::opt::handle_solve_multistart
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_E04_MULTISTART_HPP
+#define NAGCPP_E04_MULTISTART_HPP
+
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "utility/nagcpp_error_handler.hpp"
+#include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace nagcpp {
+  namespace opt {
+    // handle_solve_multistart
+    // Solves a problem defined via the NAG optimization modelling suite from
+    // a number of starting points, with the starts run concurrently.
+    // There is no way of copying a handle, so the model is built once per
+    // worker thread (rather than once per start) via a user supplied
+    // function. Each worker then solves its share of the starts, reusing its
+    // handle between starts.
+
+    // parameters:
+    //   nvar: types::f77_integer, scalar
+    //     n, the number of decision variables in the model
+    //   build: void, function
+    //     Defines the model in a newly initialized handle
+    //     build(handle)
+    //     parameters:
+    //       handle: opt::CommE04RA
+    //         A handle initialized via opt::handle_init (e04ra) with nvar
+    //         variables
+    //   solve: void, function
+    //     Solves the problem held in the handle from a given starting point,
+    //     by calling one of the handle solvers (for example,
+    //     opt::handle_solve_bounds_foas (e04kf) or
+    //     opt::handle_solve_ipopt (e04st))
+    //     solve(handle, x, rinfo, stats, best)
+    //     parameters:
+    //       handle: opt::CommE04RA
+    //         The handle created by build
+    //       x: std::vector<double>, shape(nvar)
+    //         On entry: the starting point
+    //         On exit: the final estimate of the solution
+    //       rinfo: std::vector<double>
+    //         On exit: the rinfo array returned by the solver, rinfo[0] is
+    //         taken to be the final objective value
+    //       stats: std::vector<double>
+    //         On exit: the stats array returned by the solver
+    //       best: const opt::MultistartBest
+    //         The best objective value found so far by any start, this can
+    //         be used, for example, to terminate unpromising starts from a
+    //         monitoring function
+    //     any error_handler::Exception thrown by solve is recorded against
+    //     that start and the remaining starts continue, any other exception
+    //     is rethrown once all workers have stopped. A start whose solve
+    //     threw an error_handler::WarningException keeps rinfo[0] as its
+    //     objective value
+    //   starts: array of containers of double, shape(nstarts, nvar)
+    //     The starting points
+    //   opt: opt::OptionalMultistart
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       nthreads: int, scalar
+    //         The number of worker threads (and handles) used
+    //         (values <= 0 use std::thread::hardware_concurrency threads)
+    //         default value: 1
+    //       cutoff: double, scalar
+    //         No further starts are begun once an objective value <= cutoff
+    //         has been found
+    //         default value: -infinity (all starts are run)
+    //       fail: error_handler::ErrorHandler
+
+    // returns: std::vector<opt::MultistartResult>
+    //   The results for each start that was run, ranked by objective value
+    //   (best first). Starts whose solve threw an error (rather than a
+    //   warning) are placed last.
+
+    // best objective value found so far, shared between the workers
+    class MultistartBest {
+    private:
+      mutable std::mutex mtx;
+      double fbest;
+      size_t ibest;
+
+    public:
+      MultistartBest()
+        : fbest(std::numeric_limits<double>::infinity()), ibest(0) {}
+      // the best objective value so far (infinity if no start has finished)
+      double value(void) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return fbest;
+      }
+      // index of the start that gave value()
+      size_t start(void) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return ibest;
+      }
+      // update the best value, returns true if f was an improvement
+      bool update(double f, size_t istart) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (f < fbest) {
+          fbest = f;
+          ibest = istart;
+          return true;
+        }
+        return false;
+      }
+    };
+
+    // result of a single start
+    struct MultistartResult {
+      // index of the starting point in starts
+      size_t start;
+      // final estimate of the solution
+      std::vector<double> x;
+      std::vector<double> rinfo;
+      std::vector<double> stats;
+      // errorid of any error_handler::Exception thrown by solve (0 if none)
+      types::f77_integer errorid;
+      // final objective value (rinfo[0]), NaN if solve threw an error
+      double objective;
+    };
+
+    class OptionalMultistart : public utility::Optional {
+    private:
+      int nthreads_value;
+      double cutoff_value;
+
+    public:
+      OptionalMultistart()
+        : Optional(), nthreads_value(1),
+          cutoff_value(-std::numeric_limits<double>::infinity()) {}
+      OptionalMultistart &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
+      OptionalMultistart &cutoff(double value) {
+        cutoff_value = value;
+        return (*this);
+      }
+      double get_cutoff(void) { return cutoff_value; }
+      template <typename BUILD, typename SOLVE, typename STARTS>
+      friend std::vector<MultistartResult>
+        handle_solve_multistart(const types::f77_integer nvar, BUILD &&build,
+                                SOLVE &&solve, const STARTS &starts,
+                                opt::OptionalMultistart &opt);
+    };
+
+    template <typename BUILD, typename SOLVE, typename STARTS>
+    std::vector<MultistartResult>
+      handle_solve_multistart(const types::f77_integer nvar, BUILD &&build,
+                              SOLVE &&solve, const STARTS &starts,
+                              opt::OptionalMultistart &opt) {
+      opt.fail.prepare("opt::handle_solve_multistart");
+      size_t nstarts = static_cast<size_t>(starts.size());
+      size_t nworkers =
+        std::min(utility::thread_count(opt.nthreads_value), nstarts);
+      double cutoff = opt.cutoff_value;
+
+      MultistartBest best;
+      std::vector<MultistartResult> results(nstarts);
+      // (char rather than bool, as the workers write to this concurrently)
+      std::vector<char> ran(nstarts, 0);
+      // starts are handed out one at a time, so that a worker that finishes
+      // early picks up the next available start
+      std::atomic<size_t> next_start(0);
+
+      utility::parallel_for(
+        nworkers, static_cast<int>(nworkers), [&](size_t, size_t, size_t) {
+          opt::CommE04RA handle(nvar);
+          build(handle);
+          for (size_t istart = next_start++; istart < nstarts;
+               istart = next_start++) {
+            if (best.value() <= cutoff) {
+              break;
+            }
+            MultistartResult &result = results[istart];
+            result.start = istart;
+            result.x.assign(std::begin(starts[istart]),
+                            std::end(starts[istart]));
+            result.errorid = 0;
+            result.objective = std::numeric_limits<double>::quiet_NaN();
+            try {
+              solve(handle, result.x, result.rinfo, result.stats,
+                    static_cast<const MultistartBest &>(best));
+              if (!result.rinfo.empty()) {
+                result.objective = result.rinfo[0];
+                best.update(result.objective, istart);
+              }
+            } catch (error_handler::WarningException &e) {
+              // the solver has returned a usable point, so the start still
+              // counts towards the ranking
+              result.errorid = e.errorid;
+              if (!result.rinfo.empty()) {
+                result.objective = result.rinfo[0];
+                best.update(result.objective, istart);
+              }
+            } catch (error_handler::ErrorException &e) {
+              result.errorid = e.errorid;
+            } catch (error_handler::CallbackException &e) {
+              result.errorid = e.errorid;
+            } catch (error_handler::Exception &e) {
+              result.errorid = e.errorid;
+            }
+            ran[istart] = 1;
+          }
+        });
+
+      // rank the starts that were run, best first
+      std::vector<MultistartResult> ranked;
+      ranked.reserve(nstarts);
+      for (size_t i = 0; i < nstarts; ++i) {
+        if (ran[i]) {
+          ranked.push_back(std::move(results[i]));
+        }
+      }
+      std::stable_sort(
+        ranked.begin(), ranked.end(),
+        [](const MultistartResult &a, const MultistartResult &b) {
+          bool a_ok = !std::isnan(a.objective);
+          bool b_ok = !std::isnan(b.objective);
+          if (a_ok != b_ok) {
+            return a_ok;
+          }
+          return a_ok && a.objective < b.objective;
+        });
+      return ranked;
+    }
+
+    // alt-1
+    template <typename BUILD, typename SOLVE, typename STARTS>
+    std::vector<MultistartResult>
+      handle_solve_multistart(const types::f77_integer nvar, BUILD &&build,
+                              SOLVE &&solve, const STARTS &starts) {
+      opt::OptionalMultistart local_opt;
+
+      return handle_solve_multistart(nvar, build, solve, starts, local_opt);
+    }
+  }
+}
+#endif
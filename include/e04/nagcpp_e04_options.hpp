@@ -0,0 +1,287 @@
+// Header for the option descriptors used with nagcpp::opt::CommE04RA and
+// nagcpp::opt::CommE04WB
+
+// Copyright 2025, Numerical Algorithms Group Ltd, Oxford, UK.
+#ifndef NAGCPP_E04_OPTIONS_HPP
+#define NAGCPP_E04_OPTIONS_HPP
+
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_utility_options.hpp"
+#include <string>
+
+namespace nagcpp {
+  namespace opt {
+    class CommE04RA;
+    class CommE04WB;
+
+    // options that can be set via opt::handle_opt_set (e04zm), using
+    // opt::CommE04RA::set or opt::CommE04RA::set_options
+    // (see opt::CommE04RA for a description of each option)
+    namespace e04zm_options {
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFLSSmallResidualsTol{"DFLS Small Residuals Tol"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        DFNODetectUnbounded{"DFNO Detect Unbounded"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFNOObjectiveLimit{"DFNO Objective Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        DFOInitialInterpPoints{"DFO Initial Interp Points"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOMaxObjectiveCalls{"DFO Max Objective Calls"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOMaxSoftRestarts{"DFO Max Soft Restarts"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOMaxUnsuccSoftRestarts{"DFO Max Unsucc Soft Restarts"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOMaximumSlowSteps{"DFO Maximum Slow Steps"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOMonitorFrequency{"DFO Monitor Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFONoiseLevel{"DFO Noise Level"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        DFONoisyProblem{"DFO Noisy Problem"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFONumberInitialPoints{"DFO Number Initial Points"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFONumberInterpPoints{"DFO Number Interp Points"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFONumberSoftRestartsPts{"DFO Number Soft Restarts Pts"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFOPrintFrequency{"DFO Print Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        DFORandomSeed{"DFO Random Seed"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFOStartingTrustRegion{"DFO Starting Trust Region"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFOTrustRegionSlowTol{"DFO Trust Region Slow Tol"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        DFOTrustRegionTolerance{"DFO Trust Region Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        DIMACSMeasures{"DIMACS Measures"};
+      constexpr utility::OptionDescriptor<CommE04RA, utility::OptionKeyword>
+        Defaults{"Defaults"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        FOASEstimateDerivatives{"FOAS Estimate Derivatives"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASFiniteDiffInterval{"FOAS Finite Diff Interval"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        FOASIterationLimit{"FOAS Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        FOASMemory{"FOAS Memory"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        FOASMonitorFrequency{"FOAS Monitor Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        FOASPrintFrequency{"FOAS Print Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASProgressTolerance{"FOAS Progress Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASRelStopTolerance{"FOAS Rel Stop Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASRestartFactor{"FOAS Restart Factor"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASSlowTolerance{"FOAS Slow Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        FOASStopTolerance{"FOAS Stop Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        FOASToleranceNorm{"FOAS Tolerance Norm"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        HessianDensity{"Hessian Density"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        HessianMode{"Hessian Mode"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InfiniteBoundSize{"Infinite Bound Size"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InitValueP{"Init Value P"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InitValuePmat{"Init Value Pmat"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        InitialP{"Initial P"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        InitialU{"Initial U"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InitialValueUbox{"Initial Value Ubox"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InitialValueUlin{"Initial Value Ulin"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InitialValueUnln{"Initial Value Unln"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        InitialX{"Initial X"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        InnerIterationLimit{"Inner Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        InnerStopCriteria{"Inner Stop Criteria"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        InnerStopTolerance{"Inner Stop Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        LPIPMAlgorithm{"LPIPM Algorithm"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        LPIPMCentralityCorrectors{"LPIPM Centrality Correctors"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        LPIPMIterationLimit{"LPIPM Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        LPIPMMaxIterativeRefinement{"LPIPM Max Iterative Refinement"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        LPIPMMonitorFrequency{"LPIPM Monitor Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        LPIPMScaling{"LPIPM Scaling"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        LPIPMStopTolerance{"LPIPM Stop Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        LPIPMStopTolerance2{"LPIPM Stop Tolerance 2"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        LPIPMSystemFormulation{"LPIPM System Formulation"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        LPPresolve{"LP Presolve"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        LinesearchMode{"Linesearch Mode"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string> List{"List"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        MatrixOrdering{"Matrix Ordering"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        MonitorFrequency{"Monitor Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        MonitoringFile{"Monitoring File"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        MonitoringLevel{"Monitoring Level"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        NLPFactorizationMethod{"NLP Factorization Method"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        OuterIterationLimit{"Outer Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, double> PMin{"P Min"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        PUpdateSpeed{"P Update Speed"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        PmatMin{"Pmat Min"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        Preference{"Preference"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        PresolveBlockDetect{"Presolve Block Detect"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        PrintFile{"Print File"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        PrintLevel{"Print Level"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        PrintOptions{"Print Options"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        PrintSolution{"Print Solution"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        SOCPFactorizationMethod{"SOCP Factorization Method"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        SOCPIterationLimit{"SOCP Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, types::f77_integer>
+        SOCPMonitorFrequency{"SOCP Monitor Frequency"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        SOCPPresolve{"SOCP Presolve"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        SOCPScaling{"SOCP Scaling"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        SOCPStopTolerance{"SOCP Stop Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        SOCPStopTolerance2{"SOCP Stop Tolerance 2"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        SOCPSystemFormulation{"SOCP System Formulation"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        StatsTime{"Stats Time"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        StopCriteria{"Stop Criteria"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        StopTolerance1{"Stop Tolerance 1"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        StopTolerance2{"Stop Tolerance 2"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        StopToleranceFeasibility{"Stop Tolerance Feasibility"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string> Task{"Task"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        TimeLimit{"Time Limit"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        TransformConstraints{"Transform Constraints"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        UUpdateRestriction{"U Update Restriction"};
+      constexpr utility::OptionDescriptor<CommE04RA, double>
+        UmatUpdateRestriction{"Umat Update Restriction"};
+      constexpr utility::OptionDescriptor<CommE04RA, std::string>
+        VerifyDerivatives{"Verify Derivatives"};
+    }
+
+    // options that can be set via opt::nlp1_option_string (e04ue), using
+    // opt::CommE04WB::set or opt::CommE04WB::set_options
+    // (see opt::CommE04WB for a description of each option)
+    namespace e04ue_options {
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        CentralDifferenceInterval{"Central Difference Interval"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        ColdStart{"Cold Start"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        CrashTolerance{"Crash Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        Defaults{"Defaults"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        DerivativeLevel{"Derivative Level"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        DifferenceInterval{"Difference Interval"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        FeasibilityTolerance{"Feasibility Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        FunctionPrecision{"Function Precision"};
+      constexpr utility::OptionDescriptor<CommE04WB, std::string>
+        Hessian{"Hessian"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        InfiniteBoundSize{"Infinite Bound Size"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        InfiniteStepSize{"Infinite Step Size"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        IterationLimit{"Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        Iters{"Iters"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        Itns{"Itns"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        LineSearchTolerance{"Line Search Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        LinearFeasibilityTolerance{"Linear Feasibility Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        List{"List"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        MajorIterationLimit{"Major Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        MajorPrintLevel{"Major Print Level"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        MinorIterationLimit{"Minor Iteration Limit"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        MinorPrintLevel{"Minor Print Level"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        MonitoringFile{"Monitoring File"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        Nolist{"Nolist"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        NonlinearFeasibilityTolerance{"Nonlinear Feasibility Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        OptimalityTolerance{"Optimality Tolerance"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        PrintLevel{"Print Level"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        StartConstraintCheckAtVariable{"Start Constraint Check At Variable"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        StartObjectiveCheckAtVariable{"Start Objective Check At Variable"};
+      constexpr utility::OptionDescriptor<CommE04WB, double>
+        StepLimit{"Step Limit"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        StopConstraintCheckAtVariable{"Stop Constraint Check At Variable"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        StopObjectiveCheckAtVariable{"Stop Objective Check At Variable"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        Verify{"Verify"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        VerifyConstraintGradients{"Verify Constraint Gradients"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        VerifyGradients{"Verify Gradients"};
+      constexpr utility::OptionDescriptor<CommE04WB, types::f77_integer>
+        VerifyLevel{"Verify Level"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        VerifyObjectiveGradients{"Verify Objective Gradients"};
+      constexpr utility::OptionDescriptor<CommE04WB, utility::OptionKeyword>
+        WarmStart{"Warm Start"};
+    }
+  }
+}
+#endif
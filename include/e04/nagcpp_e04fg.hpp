@@ -12,8 +12,13 @@
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
 #include "utility/nagcpp_utility_comm.hpp"
+#include "utility/nagcpp_utility_array.hpp"
 #include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
 #include "utility/nagcpp_utility_print_rec.hpp"
+#include <algorithm>
+#include <exception>
+#include <vector>
 
 namespace nagcpp {
   namespace opt {
@@ -338,8 +343,27 @@ namespace nagcpp {
     class CommE04RA;
 
     class OptionalE04FG : public utility::Optional {
+    private:
+      int nthreads_value;
+
     public:
-      OptionalE04FG() : Optional() {}
+      OptionalE04FG() : Optional(), nthreads_value(1) {}
+      // number of threads used by opt::handle_solve_dfls_parallel to
+      // evaluate the residuals (values <= 0 use
+      // std::thread::hardware_concurrency threads)
+      OptionalE04FG &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
+      template <typename COMM, typename OBJFUN, typename X, typename RX,
+                typename RINFO, typename STATS>
+      friend void handle_solve_dfls_parallel(COMM &comm, OBJFUN &&objfun,
+                                             const types::f77_integer nres,
+                                             const types::f77_integer maxeval,
+                                             X &&x, RX &&rx, RINFO &&rinfo,
+                                             STATS &&stats,
+                                             opt::OptionalE04FG &opt);
       template <typename COMM, typename X, typename RX, typename RINFO,
                 typename STATS>
       friend void handle_solve_dfls_rcomm(COMM &comm,
@@ -356,6 +380,8 @@ namespace nagcpp {
                                  RINFO &&rinfo, STATS &&stats,
                                  opt::OptionalE04FG &opt) {
       opt.fail.prepare("opt::handle_solve_dfls_rcomm (e04fg)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -430,6 +456,7 @@ namespace nagcpp {
                irevcm, neval, local_maxeval, local_nvar, local_x.data,
                local_nres, local_rx.data, local_rinfo.data, local_stats.data,
                opt.fail.errbuf, opt.fail.errorid, opt.fail.errbuf_length);
+      opt.iomanager->flush();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 100) {
@@ -663,6 +690,168 @@ namespace nagcpp {
       handle_solve_dfls_rcomm(comm, irevcm, neval, x, rx, rinfo, stats,
                               local_opt);
     }
+
+    // handle_solve_dfls_parallel
+    // Forward communication driver for opt::handle_solve_dfls_rcomm (e04fg).
+    // The reverse communication loop is run internally, and each time the
+    // solver requests residuals at neval points, the points are evaluated
+    // concurrently by calling objfun from up to opt.nthreads threads.
+
+    // parameters:
+    //   comm: opt::CommE04RA, scalar
+    //     Communication structure, as for opt::handle_solve_dfls_rcomm (e04fg)
+    //   objfun: void, function
+    //     Evaluates the residuals at a single point
+    //     objfun(x, rx)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //         The point at which the residuals are to be evaluated
+    //       rx: utility::vector_view<double>, shape(nres)
+    //         On exit: the residuals at x
+    //     objfun can be called concurrently from more than one thread, each
+    //     call writes to a different rx
+    //   nres: types::f77_integer, scalar
+    //     m_r, the number of residuals in the problem
+    //   maxeval: types::f77_integer, scalar
+    //     The maximum number of function evaluations that can be requested at the
+    //     same time
+    //   x: double, array, shape(nvar)
+    //     On entry: x_0, the initial estimates of the variables x
+    //     On exit: the best computed estimate of the solution
+    //   rx: double, array, shape(nres)
+    //     On exit: the residuals of the best computed point
+    //   rinfo: double, array, shape(100)
+    //     On exit, if not null on entry: optimal objective value and various
+    //     indicators at the end of the final iteration
+    //   stats: double, array, shape(100)
+    //     On exit, if not null on entry: solver statistics at the end of the
+    //     final iteration
+    //   opt: opt::OptionalE04FG
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       nthreads: int, scalar
+    //         The number of threads used to evaluate the residuals
+    //         default value: 1
+    //       fail: error_handler::ErrorHandler
+
+    // error_handler::ErrorException, error_handler::WarningException
+    //   as for opt::handle_solve_dfls_rcomm (e04fg)
+    // error_handler::CallbackException
+    //   (errorid 10701)
+    //     An exception was thrown in a callback.
+    //     The solve is abandoned, comm should be reinitialized before being
+    //     used again.
+
+    template <typename COMM, typename OBJFUN, typename X, typename RX,
+              typename RINFO, typename STATS>
+    void handle_solve_dfls_parallel(COMM &comm, OBJFUN &&objfun,
+                                    const types::f77_integer nres,
+                                    const types::f77_integer maxeval, X &&x,
+                                    RX &&rx, RINFO &&rinfo, STATS &&stats,
+                                    opt::OptionalE04FG &opt) {
+      opt.fail.prepare("opt::handle_solve_dfls_parallel");
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             typename std::remove_reference<X>::type>
+        local_x(x);
+      types::f77_integer local_nvar =
+        data_handling::get_size(opt.fail, "nvar", local_x, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                             typename std::remove_reference<RX>::type>
+        local_rx(rx);
+      local_rx.resize(rx, nres);
+
+      local_rx.check(opt.fail, "rx", true, nres);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_x.check(opt.fail, "x", true, local_nvar);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+
+      // the full x and rx arrays passed to the solver, stored in column
+      // major order so that each point / set of residuals is contiguous
+      size_t nvar = static_cast<size_t>(local_nvar);
+      size_t nr = static_cast<size_t>(nres);
+      size_t ncols = static_cast<size_t>(std::max(maxeval, 1));
+      std::vector<double> xs(nvar * ncols, 0.0);
+      std::vector<double> rxs(nr * ncols, 0.0);
+      for (size_t i = 0; i < nvar; ++i) {
+        xs[i] = local_x.data[i];
+      }
+      utility::array2D<double, data_handling::ArgIntent::IntentINOUT> ax(
+        xs.data(), local_nvar, maxeval);
+      utility::array2D<double, data_handling::ArgIntent::IntentINOUT> arx(
+        rxs.data(), nres, maxeval);
+
+      auto copy_best = [&](void) {
+        for (size_t i = 0; i < nvar; ++i) {
+          local_x.data[i] = xs[i];
+        }
+        for (size_t i = 0; i < nr; ++i) {
+          local_rx.data[i] = rxs[i];
+        }
+        local_x.copy_back(x);
+        local_rx.copy_back(rx);
+      };
+
+      types::f77_integer irevcm = 0;
+      types::f77_integer neval = 0;
+      do {
+        try {
+          handle_solve_dfls_rcomm(comm, irevcm, neval, ax, arx, rinfo, stats,
+                                  opt);
+        } catch (error_handler::WarningException &) {
+          copy_best();
+          throw;
+        }
+        if (opt.fail.error_thrown) {
+          return;
+        }
+        if (irevcm == 1) {
+          try {
+            utility::parallel_for(
+              static_cast<size_t>(neval), opt.nthreads_value,
+              [&](size_t begin, size_t end, size_t) {
+                for (size_t j = begin; j < end; ++j) {
+                  utility::vector_view<const double> xj(xs.data() + j * nvar,
+                                                        nvar);
+                  utility::vector_view<double> rxj(rxs.data() + j * nr, nr);
+                  objfun(xj, rxj);
+                }
+              });
+          } catch (...) {
+            error_handler::ExceptionPointer ep;
+            ep.eptr = std::current_exception();
+            types::engine_data en_data;
+            engine_routines::y90haan_(en_data);
+            en_data.hlperr = error_handler::HLPERR_USER_EXCEPTION;
+            en_data.wrapptr1 = static_cast<void *>(&ep);
+            opt.fail.prepare("opt::handle_solve_dfls_parallel");
+            opt.fail.initial_error_handler(en_data);
+            return;
+          }
+        }
+      } while (irevcm != 0);
+
+      copy_best();
+    }
+
+    // alt-1
+    template <typename COMM, typename OBJFUN, typename X, typename RX,
+              typename RINFO, typename STATS>
+    void handle_solve_dfls_parallel(COMM &comm, OBJFUN &&objfun,
+                                    const types::f77_integer nres,
+                                    const types::f77_integer maxeval, X &&x,
+                                    RX &&rx, RINFO &&rinfo, STATS &&stats) {
+      opt::OptionalE04FG local_opt;
+
+      handle_solve_dfls_parallel(comm, objfun, nres, maxeval, x, rx, rinfo,
+                                 stats, local_opt);
+    }
   }
 }
 #define e04fg opt::handle_solve_dfls_rcomm
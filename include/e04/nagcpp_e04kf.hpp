@@ -6,12 +6,14 @@
 #ifndef NAGCPP_E04KF_HPP
 #define NAGCPP_E04KF_HPP
 
+#include "e04/nagcpp_e04_eval_cache.hpp"
 #include "utility/nagcpp_callback_handling.hpp"
 #include "utility/nagcpp_consts.hpp"
 #include "utility/nagcpp_data_handling.hpp"
 #include "utility/nagcpp_engine_routines.hpp"
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
+#include "utility/nagcpp_utility_array.hpp"
 #include "utility/nagcpp_utility_comm.hpp"
 #include "utility/nagcpp_utility_macros.hpp"
 #include "utility/nagcpp_utility_optional.hpp"
@@ -373,8 +375,16 @@ namespace nagcpp {
     class CommE04RA;
 
     class OptionalE04KF : public utility::Optional {
+    private:
+      size_t callback_allocations_value;
+
     public:
-      OptionalE04KF() : Optional() {}
+      OptionalE04KF() : Optional(), callback_allocations_value(0) {}
+      // number of heap allocations made while converting arguments into
+      // the users types inside the callbacks during the last call
+      size_t get_callback_allocations(void) {
+        return callback_allocations_value;
+      }
       template <typename COMM, typename OBJFUN, typename OBJGRD, typename MONIT,
                 typename X, typename RINFO, typename STATS>
       friend void handle_solve_bounds_foas(COMM &comm, OBJFUN &&objfun,
@@ -397,6 +407,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[0])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
           objfun(callbacks, en_data, local_x, fx, inform);
         } else {
           e04kfvt_(en_data, nvar, x, fx, inform, iuser, ruser);
@@ -427,7 +438,7 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x);
+          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x, callbacks->scratch);
 
         objfun(local_x.get(), fx, inform);
       }
@@ -460,6 +471,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[1])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 1);
           objgrd(callbacks, en_data, local_x, local_fdx, inform);
         } else {
           e04kfwt_(en_data, nvar, x, nnzfd, fdx, inform, iuser, ruser);
@@ -491,10 +503,11 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, OBJGRD_X>(x);
+          data_handling::ArgIntent::IntentIN, OBJGRD_X>(x, callbacks->scratch);
         auto local_fdx = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, OBJGRD_FDX>(fdx);
+          data_handling::ArgIntent::IntentINOUT, OBJGRD_FDX>(
+          fdx, callbacks->scratch);
 
         objgrd(local_x.get(), local_fdx.get(), inform);
       }
@@ -528,6 +541,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 2);
         monit(callbacks, en_data, local_x, local_rinfo, local_stats);
 
       } catch (const error_handler::CallbackEarlyTermination &e) {
@@ -568,13 +582,15 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_X>(x);
+          data_handling::ArgIntent::IntentIN, MONIT_X>(x, callbacks->scratch);
         auto local_rinfo = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_RINFO>(rinfo);
+          data_handling::ArgIntent::IntentIN, MONIT_RINFO>(
+          rinfo, callbacks->scratch);
         auto local_stats = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_STATS>(stats);
+          data_handling::ArgIntent::IntentIN, MONIT_STATS>(
+          stats, callbacks->scratch);
 
         monit(local_x.get(), local_rinfo.get(), local_stats.get());
       }
@@ -601,6 +617,8 @@ namespace nagcpp {
                                   MONIT &&monit, X &&x, RINFO &&rinfo,
                                   STATS &&stats, opt::OptionalE04KF &opt) {
       opt.fail.prepare("opt::handle_solve_bounds_foas (e04kf)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -618,6 +636,7 @@ namespace nagcpp {
       }
       data_handling::CallbackAddresses callbacks(3);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       callbacks.address[0] =
         callback_handling::function_to_void_pointer(objfun);
       callbacks.address[1] =
@@ -687,11 +706,17 @@ namespace nagcpp {
         return;
       }
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler, {"objfun", "objgrd", "monit"});
       e04kfft_(en_data, local_print_rec, utility::print_rech, &comm.handle,
                local_objfun, e04kf_objfunh, local_objgrd, e04kf_objgrdh,
                local_monit, e04kf_monith, local_nvar, local_x.data,
                local_rinfo.data, local_stats.data, local_iuser, local_ruser,
                opt.fail.errbuf, opt.fail.errorid, opt.fail.errbuf_length);
+      solve_timer.stop();
+      opt.iomanager->flush();
+
+      opt.callback_allocations_value = callbacks.scratch.allocations();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 100) {
@@ -812,6 +837,72 @@ namespace nagcpp {
       handle_solve_bounds_foas(comm, objfun, objgrd, monit, x, rinfo, stats,
                                local_opt);
     }
+
+    // handle_solve_bounds_foas (fused objective and gradient)
+    // As above, but with a single callback, objfg, that can calculate both
+    // the objective function and its gradient, for problems where the two
+    // share most of their computation.
+    // objfg is called via the objfun and objgrd entry points of the solver,
+    // with the value and gradient from the last call held in a one point
+    // cache, so the solver asking for both at the same x only results in
+    // objfg being asked for each of them once.
+
+    // parameters:
+    //   objfg: void, function
+    //     objfg(x, fx, fdx, need_f, need_g, inform)
+    //     parameters:
+    //       x: const utility::vector_view<const double>, shape(nvar)
+    //         The vector x of variable values at which the objective function
+    //         and / or its gradient are to be evaluated
+    //       fx: double, scalar
+    //         On exit: if need_f is true, the value of the objective function
+    //         at x
+    //       fdx: utility::vector_view<double>, shape(nnzfd)
+    //         On exit: if need_g is true, the values of the nonzero elements
+    //         in the sparse gradient vector, in the order specified by idxfd
+    //         in a previous call to opt::handle_set_nlnobj (e04rg)
+    //       need_f: bool, scalar
+    //         true if fx is required. If need_f is false, then x is the same
+    //         point as in the previous call to objfg, so any intermediate
+    //         results from that call can be reused
+    //       need_g: bool, scalar
+    //         true if fdx is required
+    //       inform: types::f77_integer, scalar
+    //         On entry: a non-negative value
+    //         On exit: may be used to indicate that the function cannot be
+    //         evaluated at the requested point x by setting inform < 0
+    //   all other parameters are as for opt::handle_solve_bounds_foas (e04kf)
+
+    template <typename COMM, typename OBJFG, typename MONIT, typename X,
+              typename RINFO, typename STATS>
+    void handle_solve_bounds_foas(COMM &comm, OBJFG &&objfg, MONIT &&monit,
+                                  X &&x, RINFO &&rinfo, STATS &&stats,
+                                  opt::OptionalE04KF &opt) {
+      internal::FusedObjectiveEvaluationCache<
+        typename std::remove_reference<OBJFG>::type>
+        cache(objfg);
+      auto local_objfun = [&cache](const utility::vector_view<const double> &xv,
+                                   double &fx, types::f77_integer &inform) {
+        cache.objfun(xv, fx, inform);
+      };
+      auto local_objgrd = [&cache](const utility::vector_view<const double> &xv,
+                                   utility::vector_view<double> &fdx,
+                                   types::f77_integer &inform) {
+        cache.objgrd(xv, fdx, inform);
+      };
+      handle_solve_bounds_foas(comm, local_objfun, local_objgrd, monit, x,
+                               rinfo, stats, opt);
+    }
+
+    // alt-1
+    template <typename COMM, typename OBJFG, typename MONIT, typename X,
+              typename RINFO, typename STATS>
+    void handle_solve_bounds_foas(COMM &comm, OBJFG &&objfg, MONIT &&monit,
+                                  X &&x, RINFO &&rinfo, STATS &&stats) {
+      opt::OptionalE04KF local_opt;
+
+      handle_solve_bounds_foas(comm, objfg, monit, x, rinfo, stats, local_opt);
+    }
   }
 }
 #define e04kf opt::handle_solve_bounds_foas
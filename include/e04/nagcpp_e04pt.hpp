@@ -304,6 +304,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
         monit(callbacks, en_data, local_comm, local_rinfo, local_stats);
 
       } catch (const error_handler::CallbackEarlyTermination &e) {
@@ -369,6 +370,8 @@ namespace nagcpp {
                                STATS &&stats, MONIT &&monit,
                                opt::OptionalE04PT &opt) {
       opt.fail.prepare("opt::handle_solve_socp_ipm (e04pt)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -395,6 +398,7 @@ namespace nagcpp {
         local_uc(uc);
       data_handling::CallbackAddresses callbacks(1);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       callbacks.address[0] = callback_handling::function_to_void_pointer(monit);
 
       void *local_print_rec = static_cast<void *>(&opt.iomanager);
@@ -465,12 +469,16 @@ namespace nagcpp {
         return;
       }
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler, {"monit"});
       e04ptft_(en_data, local_print_rec, utility::print_rech, &comm.handle,
                vl_e04pta_nvar, local_x.data, vl_e04pta_nnzu, local_u.data,
                vl_e04pta_nnzuc, local_uc.data, local_rinfo.data,
                local_stats.data, local_monit, e04pt_monith, local_iuser,
                local_ruser, opt.fail.errbuf, opt.fail.errorid,
                opt.fail.errbuf_length);
+      solve_timer.stop();
+      opt.iomanager->flush();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 100) {
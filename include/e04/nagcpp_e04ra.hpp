@@ -82,6 +82,8 @@ namespace nagcpp {
     void handle_init(COMM &comm, const types::f77_integer nvar,
                      opt::OptionalE04RA &opt) {
       opt.fail.prepare("opt::handle_init (e04ra)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -109,6 +111,7 @@ namespace nagcpp {
       }
 
       comm.initialized = true;
+      comm.handle_changed();
       opt.fail.throw_warning();
     }
 
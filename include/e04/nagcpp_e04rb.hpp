@@ -144,6 +144,8 @@ namespace nagcpp {
                           const GROUP &group, types::f77_integer &idgroup,
                           opt::OptionalE04RB &opt) {
       opt.fail.prepare("opt::handle_set_group (e04rb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
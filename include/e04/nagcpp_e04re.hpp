@@ -107,6 +107,8 @@ namespace nagcpp {
     void handle_set_linobj(COMM &comm, const CVEC &cvec,
                            opt::OptionalE04RE &opt) {
       opt.fail.prepare("opt::handle_set_linobj (e04re)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
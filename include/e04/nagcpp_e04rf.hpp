@@ -150,6 +150,8 @@ namespace nagcpp {
                             const IROWH &irowh, const ICOLH &icolh, const H &h,
                             opt::OptionalE04RF &opt) {
       opt.fail.prepare("opt::handle_set_quadobj (e04rf)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
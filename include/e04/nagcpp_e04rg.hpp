@@ -112,6 +112,8 @@ namespace nagcpp {
     void handle_set_nlnobj(COMM &comm, const IDXFD &idxfd,
                            opt::OptionalE04RG &opt) {
       opt.fail.prepare("opt::handle_set_nlnobj (e04rg)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
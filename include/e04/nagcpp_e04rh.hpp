@@ -122,6 +122,8 @@ namespace nagcpp {
     void handle_set_simplebounds(COMM &comm, const BL &bl, const BU &bu,
                                  opt::OptionalE04RH &opt) {
       opt.fail.prepare("opt::handle_set_simplebounds (e04rh)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
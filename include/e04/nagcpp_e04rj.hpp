@@ -176,6 +176,8 @@ namespace nagcpp {
                               const IROWB &irowb, const ICOLB &icolb,
                               const B &b, opt::OptionalE04RJ &opt) {
       opt.fail.prepare("opt::handle_set_linconstr (e04rj)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -154,6 +154,8 @@ namespace nagcpp {
                               const IROWGD &irowgd, const ICOLGD &icolgd,
                               opt::OptionalE04RK &opt) {
       opt.fail.prepare("opt::handle_set_nlnconstr (e04rk)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
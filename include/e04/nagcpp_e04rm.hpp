@@ -138,6 +138,8 @@ namespace nagcpp {
                           const IROWRD &irowrd, const ICOLRD &icolrd,
                           opt::OptionalE04RM &opt) {
       opt.fail.prepare("opt::handle_set_nlnls (e04rm)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
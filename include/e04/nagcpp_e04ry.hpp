@@ -108,6 +108,8 @@ namespace nagcpp {
     void handle_print(COMM &comm, const types::f77_integer nout,
                       const std::string cmdstr, opt::OptionalE04RY &opt) {
       opt.fail.prepare("opt::handle_print (e04ry)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -129,6 +131,7 @@ namespace nagcpp {
       e04ryft_(en_data, local_print_rec, utility::print_rech, &comm.handle,
                nout, local_cmdstr.data, opt.fail.errbuf, opt.fail.errorid,
                local_cmdstr.string_length, opt.fail.errbuf_length);
+      opt.iomanager->flush();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 100) {
@@ -79,6 +79,8 @@ namespace nagcpp {
     template <typename COMM>
     void handle_free(COMM &comm, opt::OptionalE04RZ &opt) {
       opt.fail.prepare("opt::handle_free (e04rz)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -120,6 +122,7 @@ namespace nagcpp {
 
       comm.handle = nullptr;
       comm.initialized = false;
+      comm.handle_changed();
       opt.fail.throw_warning();
     }
 
@@ -560,8 +560,16 @@ namespace nagcpp {
     class CommE04RA;
 
     class OptionalE04ST : public utility::Optional {
+    private:
+      size_t callback_allocations_value;
+
     public:
-      OptionalE04ST() : Optional() {}
+      OptionalE04ST() : Optional(), callback_allocations_value(0) {}
+      // number of heap allocations made while converting arguments into
+      // the users types inside the callbacks during the last call
+      size_t get_callback_allocations(void) {
+        return callback_allocations_value;
+      }
       template <typename COMM, typename OBJFUN, typename OBJGRD,
                 typename CONFUN, typename CONGRD, typename HESS, typename MONIT,
                 typename X, typename U, typename RINFO, typename STATS>
@@ -586,6 +594,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[0])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
           objfun(callbacks, en_data, local_x, fx, inform);
         } else {
           e04stvt_(en_data, nvar, x, fx, inform, iuser, ruser);
@@ -616,7 +625,7 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x);
+          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x, callbacks->scratch);
 
         objfun(local_x.get(), fx, inform);
       }
@@ -649,6 +658,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[1])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 1);
           objgrd(callbacks, en_data, local_x, local_fdx, inform);
         } else {
           e04stwt_(en_data, nvar, x, nnzfd, fdx, inform, iuser, ruser);
@@ -680,10 +690,11 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, OBJGRD_X>(x);
+          data_handling::ArgIntent::IntentIN, OBJGRD_X>(x, callbacks->scratch);
         auto local_fdx = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, OBJGRD_FDX>(fdx);
+          data_handling::ArgIntent::IntentINOUT, OBJGRD_FDX>(
+          fdx, callbacks->scratch);
 
         objgrd(local_x.get(), local_fdx.get(), inform);
       }
@@ -717,6 +728,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[2])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 2);
           confun(callbacks, en_data, local_x, ncnln, local_gx, inform);
         } else {
           e04stxt_(en_data, nvar, x, ncnln, gx, inform, iuser, ruser);
@@ -749,10 +761,11 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, CONFUN_X>(x);
+          data_handling::ArgIntent::IntentIN, CONFUN_X>(x, callbacks->scratch);
         auto local_gx = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentOUT>,
-          data_handling::ArgIntent::IntentOUT, CONFUN_GX>(gx);
+          data_handling::ArgIntent::IntentOUT, CONFUN_GX>(
+          gx, callbacks->scratch);
 
         confun(local_x.get(), ncnln, local_gx.get(), inform);
       }
@@ -787,6 +800,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[3])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 3);
           congrd(callbacks, en_data, local_x, local_gdx, inform);
         } else {
           e04styt_(en_data, nvar, x, nnzgd, gdx, inform, iuser, ruser);
@@ -818,10 +832,11 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, CONGRD_X>(x);
+          data_handling::ArgIntent::IntentIN, CONGRD_X>(x, callbacks->scratch);
         auto local_gdx = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, CONGRD_GDX>(gdx);
+          data_handling::ArgIntent::IntentINOUT, CONGRD_GDX>(
+          gdx, callbacks->scratch);
 
         congrd(local_x.get(), local_gdx.get(), inform);
       }
@@ -859,6 +874,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[4])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 4);
           hess(callbacks, en_data, local_x, idf, sigma, local_lamda, local_hx,
                inform);
         } else {
@@ -897,13 +913,15 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, HESS_X>(x);
+          data_handling::ArgIntent::IntentIN, HESS_X>(x, callbacks->scratch);
         auto local_lamda = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, HESS_LAMDA>(lamda);
+          data_handling::ArgIntent::IntentIN, HESS_LAMDA>(
+          lamda, callbacks->scratch);
         auto local_hx = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, HESS_HX>(hx);
+          data_handling::ArgIntent::IntentINOUT, HESS_HX>(
+          hx, callbacks->scratch);
 
         hess(local_x.get(), idf, sigma, local_lamda.get(), local_hx.get(),
              inform);
@@ -946,6 +964,7 @@ namespace nagcpp {
 
       try {
         if (static_cast<bool>((*callbacks).address[5])) {
+          utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 5);
           monit(callbacks, en_data, local_x, local_u, local_rinfo, local_stats);
         } else {
           e04stut_(en_data, nvar, x, nnzu, u, inform, rinfo, stats, iuser,
@@ -990,16 +1009,18 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_X>(x);
+          data_handling::ArgIntent::IntentIN, MONIT_X>(x, callbacks->scratch);
         auto local_u = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_U>(u);
+          data_handling::ArgIntent::IntentIN, MONIT_U>(u, callbacks->scratch);
         auto local_rinfo = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_RINFO>(rinfo);
+          data_handling::ArgIntent::IntentIN, MONIT_RINFO>(
+          rinfo, callbacks->scratch);
         auto local_stats = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, MONIT_STATS>(stats);
+          data_handling::ArgIntent::IntentIN, MONIT_STATS>(
+          stats, callbacks->scratch);
 
         monit(local_x.get(), local_u.get(), local_rinfo.get(),
               local_stats.get());
@@ -1030,6 +1051,8 @@ namespace nagcpp {
                             MONIT &&monit, X &&x, U &&u, RINFO &&rinfo,
                             STATS &&stats, opt::OptionalE04ST &opt) {
       opt.fail.prepare("opt::handle_solve_ipopt (e04st)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -1047,6 +1070,7 @@ namespace nagcpp {
       }
       data_handling::CallbackAddresses callbacks(6);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       callbacks.address[0] =
         callback_handling::function_to_void_pointer(objfun);
       callbacks.address[1] =
@@ -1166,6 +1190,9 @@ namespace nagcpp {
         return;
       }
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler,
+        {"objfun", "objgrd", "confun", "congrd", "hess", "monit"});
       e04stft_(en_data, local_print_rec, utility::print_rech, &comm.handle,
                local_objfun, e04st_objfunh, local_objgrd, e04st_objgrdh,
                local_confun, e04st_confunh, local_congrd, e04st_congrdh,
@@ -1173,6 +1200,10 @@ namespace nagcpp {
                local_x.data, local_nnzu, local_u.data, local_rinfo.data,
                local_stats.data, local_iuser, local_ruser, opt.fail.errbuf,
                opt.fail.errorid, opt.fail.errbuf_length);
+      solve_timer.stop();
+      opt.iomanager->flush();
+
+      opt.callback_allocations_value = callbacks.scratch.allocations();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == -199 && opt.fail.ifmt == 100) {
@@ -487,8 +487,16 @@ namespace nagcpp {
     class CommE04WB;
 
     class OptionalE04UC : public utility::Optional {
+    private:
+      size_t callback_allocations_value;
+
     public:
-      OptionalE04UC() : Optional() {}
+      OptionalE04UC() : Optional(), callback_allocations_value(0) {}
+      // number of heap allocations made while converting arguments into
+      // the users types inside the callbacks during the last call
+      size_t get_callback_allocations(void) {
+        return callback_allocations_value;
+      }
       template <typename A, typename BL, typename BU, typename CONFUN,
                 typename OBJFUN, typename ISTATE, typename C, typename CJAC,
                 typename CLAMDA, typename OBJGRD, typename R, typename X,
@@ -523,6 +531,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 0);
         confun(callbacks, en_data, mode, local_needc, local_x, local_c,
                local_cjac, nstate);
 
@@ -566,16 +575,18 @@ namespace nagcpp {
         auto local_needc = data_handling::convert_nag_array_to_user<
           const utility::array1D<types::f77_integer,
                                  data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, CONFUN_NEEDC>(needc);
+          data_handling::ArgIntent::IntentIN, CONFUN_NEEDC>(
+          needc, callbacks->scratch);
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, CONFUN_X>(x);
+          data_handling::ArgIntent::IntentIN, CONFUN_X>(x, callbacks->scratch);
         auto local_c = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentOUT>,
-          data_handling::ArgIntent::IntentOUT, CONFUN_C>(c);
+          data_handling::ArgIntent::IntentOUT, CONFUN_C>(c, callbacks->scratch);
         auto local_cjac = data_handling::convert_nag_array_to_user<
           utility::array2D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, CONFUN_CJAC>(cjac);
+          data_handling::ArgIntent::IntentINOUT, CONFUN_CJAC>(
+          cjac, callbacks->scratch);
 
         confun(mode, local_needc.get(), local_x.get(), local_c.get(),
                local_cjac.get(), nstate);
@@ -614,6 +625,7 @@ namespace nagcpp {
         static_cast<data_handling::CallbackAddresses *>(en_data.wrapptr2);
 
       try {
+        utility::CallbackProfiler::CallTimer timer(callbacks->profiler, 1);
         objfun(callbacks, en_data, mode, local_x, objf, local_objgrd, nstate);
 
       } catch (const error_handler::CallbackEarlyTermination &e) {
@@ -651,10 +663,11 @@ namespace nagcpp {
 
         auto local_x = data_handling::convert_nag_array_to_user<
           const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
-          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x);
+          data_handling::ArgIntent::IntentIN, OBJFUN_X>(x, callbacks->scratch);
         auto local_objgrd = data_handling::convert_nag_array_to_user<
           utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
-          data_handling::ArgIntent::IntentINOUT, OBJFUN_OBJGRD>(objgrd);
+          data_handling::ArgIntent::IntentINOUT, OBJFUN_OBJGRD>(
+          objgrd, callbacks->scratch);
 
         objfun(mode, local_x.get(), objf, local_objgrd.get(), nstate);
       }
@@ -683,6 +696,8 @@ namespace nagcpp {
                     OBJGRD &&objgrd, R &&r, X &&x, COMM &comm,
                     opt::OptionalE04UC &opt) {
       opt.fail.prepare("opt::nlp1_solve (e04uc)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -690,7 +705,7 @@ namespace nagcpp {
       en_data.wrapptr1 = &ep;
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<A>::type>
-        local_a(a);
+        local_a(a, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<BL>::type>
         local_bl(bl);
@@ -699,6 +714,7 @@ namespace nagcpp {
         local_bu(bu);
       data_handling::CallbackAddresses callbacks(2);
       en_data.wrapptr2 = static_cast<void *>(std::addressof(callbacks));
+      callbacks.profiler = opt.callback_profiler.get();
       callbacks.address[0] =
         callback_handling::function_to_void_pointer(confun);
       static_assert(
@@ -714,13 +730,13 @@ namespace nagcpp {
         local_istate(istate);
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<CJAC>::type>
-        local_cjac(cjac);
+        local_cjac(cjac, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<CLAMDA>::type>
         local_clamda(clamda);
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<R>::type>
-        local_r(r);
+        local_r(r, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<X>::type>
         local_x(x);
@@ -734,6 +750,7 @@ namespace nagcpp {
           return;
         }
       }
+      comm.ensure_unique();
 
       void *local_print_rec = static_cast<void *>(&opt.iomanager);
       types::f77_integer local_n =
@@ -904,6 +921,8 @@ namespace nagcpp {
         std::max(static_cast<types::f77_integer>(1),
                  local_a.get_LD(local_storage_order));
 
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        callbacks.profiler, {"confun", "objfun"});
       e04ucft_(en_data, local_print_rec, utility::print_rech, local_n,
                local_nclin, local_ncnln, local_lda, local_ldcj, local_ldr,
                local_a.data, local_bl.data, local_bu.data, local_confun,
@@ -915,6 +934,10 @@ namespace nagcpp {
                comm.rcomm, local_routine_name.data, opt.fail.errbuf,
                opt.fail.errorid, local_routine_name.string_length,
                opt.fail.errbuf_length);
+      solve_timer.stop();
+      opt.iomanager->flush();
+
+      opt.callback_allocations_value = callbacks.scratch.allocations();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr < 0 && opt.fail.ifmt == 99999) {
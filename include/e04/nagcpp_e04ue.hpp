@@ -93,6 +93,8 @@ namespace nagcpp {
     void nlp1_option_string(const std::string optstr, COMM &comm,
                             opt::OptionalE04UE &opt) {
       opt.fail.prepare("opt::nlp1_option_string (e04ue)", false);
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -106,6 +108,7 @@ namespace nagcpp {
           return;
         }
       }
+      comm.ensure_unique();
 
       void *local_print_rec = static_cast<void *>(&opt.iomanager);
       data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
@@ -118,6 +121,7 @@ namespace nagcpp {
                local_dlist, local_routine_name.data, comm.lcomm, comm.icomm,
                comm.rcomm, opt.fail.errorid, local_optstr.string_length,
                local_routine_name.string_length);
+      opt.iomanager->flush();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 5) {
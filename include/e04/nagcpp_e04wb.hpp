@@ -88,6 +88,8 @@ namespace nagcpp {
     void nlp1_init(const std::string rname, COMM &comm,
                    opt::OptionalE04WB &opt) {
       opt.fail.prepare("opt::nlp1_init (e04wb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
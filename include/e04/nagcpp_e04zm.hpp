@@ -155,6 +155,8 @@ namespace nagcpp {
     void handle_opt_set(COMM &comm, const std::string optstr,
                         opt::OptionalE04ZM &opt) {
       opt.fail.prepare("opt::handle_opt_set (e04zm)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -162,7 +164,7 @@ namespace nagcpp {
                       std::is_same<COMM, opt::CommE04RA>::value,
                     "Invalid type for comm: must be either "
                     "utility::NoneCopyableComm or opt::CommE04RA");
-      if (!(comm.check())) {
+      if (!(comm.check_options())) {
         opt.fail.raise_error_comm_invalid("comm");
         if (opt.fail.error_thrown) {
           return;
@@ -176,6 +178,8 @@ namespace nagcpp {
       e04zmft_(en_data, local_print_rec, utility::print_rech, &comm.handle,
                local_optstr.data, opt.fail.errbuf, opt.fail.errorid,
                local_optstr.string_length, opt.fail.errbuf_length);
+      opt.iomanager->flush();
+      comm.options_changed();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 1 && opt.fail.ifmt == 100) {
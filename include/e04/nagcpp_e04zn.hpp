@@ -119,6 +119,8 @@ namespace nagcpp {
                         std::string &cvalue, types::f77_integer &optype,
                         opt::OptionalE04ZN &opt) {
       opt.fail.prepare("opt::handle_opt_get (e04zn)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -126,7 +128,7 @@ namespace nagcpp {
                       std::is_same<COMM, opt::CommE04RA>::value,
                     "Invalid type for comm: must be either "
                     "utility::NoneCopyableComm or opt::CommE04RA");
-      if (!(comm.check())) {
+      if (!(comm.check_options())) {
         opt.fail.raise_error_comm_invalid("comm");
         if (opt.fail.error_thrown) {
           return;
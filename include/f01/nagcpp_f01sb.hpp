@@ -185,18 +185,20 @@ namespace nagcpp {
                         utility::CopyableComm &comm,
                         matop::OptionalF01SB &opt) {
       opt.fail.prepare("matop::real_nmf_rcomm (f01sb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<W>::type>
-        local_w(w);
+        local_w(w, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<H>::type>
-        local_h(h);
+        local_h(h, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<HT>::type>
-        local_ht(ht);
+        local_ht(ht, data_handling::UseLD());
 
       types::f77_integer local_m =
         data_handling::get_size(opt.fail, "m", local_w, 1);
@@ -228,6 +230,7 @@ namespace nagcpp {
           return;
         }
       }
+      comm.ensure_unique();
       types::f77_integer local_storage_order =
         data_handling::get_storage_order(opt.default_to_col_major, local_w,
                                          local_h, local_ht);
@@ -103,12 +103,14 @@ namespace nagcpp {
     double dlange(const std::string norm, const A &a,
                   blas::OptionalF06RA &opt) {
       opt.fail.prepare("blas::dlange (f06ra)", false);
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<A>::type>
-        local_a(a);
+        local_a(a, data_handling::UseLD());
 
       data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
         local_norm(norm);
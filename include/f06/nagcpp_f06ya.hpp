@@ -128,18 +128,20 @@ namespace nagcpp {
                const double alpha, const A &a, const B &b, const double beta,
                C &&c, blas::OptionalF06YA &opt) {
       opt.fail.prepare("blas::dgemm (f06ya)", false);
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<A>::type>
-        local_a(a);
+        local_a(a, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<B>::type>
-        local_b(b);
+        local_b(b, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<C>::type>
-        local_c(c);
+        local_c(c, data_handling::UseLD());
 
       types::f77_logical local_call_vendor = 1;
       data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
@@ -127,12 +127,14 @@ namespace nagcpp {
     void dsyevd(const std::string job, const std::string uplo, A &&a, W &&w,
                 lapackeig::OptionalF08FC &opt) {
       opt.fail.prepare("lapackeig::dsyevd (f08fc)", false);
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<A>::type>
-        local_a(a);
+        local_a(a, data_handling::UseLD());
 
       types::f77_logical local_call_vendor = 1;
       data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
@@ -136,6 +136,8 @@ namespace nagcpp {
                                 const A &a, const B &b, const double beta,
                                 C &&c, sparse::OptionalF11MK &opt) {
       opt.fail.prepare("sparse::direct_real_gen_matmul (f11mk)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -152,10 +154,10 @@ namespace nagcpp {
         local_a(a);
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<B>::type>
-        local_b(b);
+        local_b(b, data_handling::UseLD());
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<C>::type>
-        local_c(c);
+        local_c(c, data_handling::UseLD());
 
       data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
         local_trans(trans);
@@ -145,6 +145,8 @@ namespace nagcpp {
                          const ICOL &icol, const X &x, Y &&y,
                          sparse::OptionalF11XA &opt) {
       opt.fail.prepare("sparse::real_gen_matvec (f11xa)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -97,6 +97,8 @@ namespace nagcpp {
     template <typename RV, typename Q, typename QV>
     void quantiles(RV &&rv, const Q &q, QV &&qv, stat::OptionalG01AM &opt) {
       opt.fail.prepare("stat::quantiles (g01am)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
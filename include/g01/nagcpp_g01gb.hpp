@@ -7,11 +7,16 @@
 #define NAGCPP_G01GB_HPP
 
 #include "utility/nagcpp_consts.hpp"
+#include "utility/nagcpp_data_handling.hpp"
 #include "utility/nagcpp_engine_routines.hpp"
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
 #include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <string>
 
 namespace nagcpp {
   namespace stat {
@@ -87,9 +92,11 @@ namespace nagcpp {
     private:
       double tol_value;
       types::f77_integer maxit_value;
+      int nthreads_value;
 
     public:
-      OptionalG01GB() : Optional(), tol_value(0.0), maxit_value(100) {}
+      OptionalG01GB()
+        : Optional(), tol_value(0.0), maxit_value(100), nthreads_value(1) {}
       OptionalG01GB &tol(double value) {
         tol_value = value;
         return (*this);
@@ -100,15 +107,30 @@ namespace nagcpp {
         return (*this);
       }
       types::f77_integer get_maxit(void) { return maxit_value; }
+      // number of threads used by the batched interface
+      // (values <= 0 use std::thread::hardware_concurrency threads)
+      OptionalG01GB &nthreads(int value) {
+        nthreads_value = value;
+        return (*this);
+      }
+      int get_nthreads(void) { return nthreads_value; }
       friend double prob_students_t_noncentral(const double t, const double df,
                                                const double delta,
                                                stat::OptionalG01GB &opt);
+      template <typename T, typename DF, typename DELTA, typename P,
+                typename IVALID>
+      friend void prob_students_t_noncentral(const T &t, const DF &df,
+                                             const DELTA &delta, P &&p,
+                                             IVALID &&ivalid,
+                                             stat::OptionalG01GB &opt);
     };
 
     double prob_students_t_noncentral(const double t, const double df,
                                       const double delta,
                                       stat::OptionalG01GB &opt) {
       opt.fail.prepare("stat::prob_students_t_noncentral (g01gb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
@@ -174,6 +196,219 @@ namespace nagcpp {
 
       return local_p;
     }
+
+    // prob_students_t_noncentral (g01gb), batched interface
+    // Computes probabilities for the non-central Student's t-distribution for
+    // a batch of (t, df, delta) triples.
+    // The engine data is initialized once per thread rather than once per
+    // probability and a failure for one element does not stop the
+    // remaining elements from being computed.
+
+    // parameters:
+    //   t: double, array, shape(lt)
+    //     t, the deviates from the Student's t-distribution
+    //   df: double, array, shape(ldf)
+    //     nu, the degrees of freedom of the Student's t-distribution
+    //   delta: double, array, shape(ldelta)
+    //     delta, the noncentrality parameters of the Students t-distribution
+    //     the ith probability is computed using t[i % lt], df[i % ldf] and
+    //     delta[i % ldelta]
+    //   p: double, array, shape(max(lt, ldf, ldelta))
+    //     The lower tail probabilities. If ivalid[i] indicates an error,
+    //     p[i] is set to NaN
+    //   ivalid: types::f77_integer, array, shape(max(lt, ldf, ldelta))
+    //     The errorid the scalar interface would have reported for each
+    //     element:
+    //     ivalid[i] = 0
+    //       No error.
+    //     ivalid[i] = 1
+    //       On entry, df < 1.0.
+    //     ivalid[i] = 3
+    //       One of the series has failed to converge (warning).
+    //     ivalid[i] = 4
+    //       The probability is too close to 0 or 1, p[i] is either an
+    //       estimate of the true value (warning) or NaN (error).
+    //     ivalid[i] < 0
+    //       An unexpected, licence or memory allocation error.
+    //   opt: stat::OptionalG01GB
+    //     Optional parameter container, derived from utility::Optional.
+    //     contains:
+    //       tol: double, scalar
+    //         The absolute accuracy required by you in the results
+    //         default value: 0.0
+    //       maxit: types::f77_integer, scalar
+    //         The maximum number of terms that are used in each of the summations
+    //         default value: 100
+    //       nthreads: int, scalar
+    //         The number of threads the batch is split across
+    //         default value: 1
+    //       fail: error_handler::ErrorHandler
+
+    // error_handler::ErrorException
+    //   (errorid 2)
+    //     On entry, opt.maxit = <value>.
+    //     Constraint: opt.maxit >= 1.
+    //   (errorid 5)
+    //     On entry, lt = <value>, ldf = <value> and ldelta = <value>.
+    //     Constraint: lt, ldf and ldelta >= 1.
+
+    // error_handler::WarningException
+    //   (errorid 1)
+    //     At least one element of the result could not be computed exactly;
+    //     see ivalid.
+
+    template <typename T, typename DF, typename DELTA, typename P,
+              typename IVALID>
+    void prob_students_t_noncentral(const T &t, const DF &df,
+                                    const DELTA &delta, P &&p, IVALID &&ivalid,
+                                    stat::OptionalG01GB &opt) {
+      opt.fail.prepare("stat::prob_students_t_noncentral (g01gb)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<T>::type>
+        local_t(t);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<DF>::type>
+        local_df(df);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             typename std::remove_reference<DELTA>::type>
+        local_delta(delta);
+
+      types::f77_integer local_lt =
+        data_handling::get_size(opt.fail, "lt", local_t, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      types::f77_integer local_ldf =
+        data_handling::get_size(opt.fail, "ldf", local_df, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      types::f77_integer local_ldelta =
+        data_handling::get_size(opt.fail, "ldelta", local_delta, 1);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      if (local_lt < 1 || local_ldf < 1 || local_ldelta < 1) {
+        opt.fail.set_errorid(5, error_handler::ErrorCategory::Error,
+                             error_handler::ErrorType::GeneralError);
+        opt.fail.append_msg(true, "On entry, lt = " + std::to_string(local_lt) +
+                                    ", ldf = " + std::to_string(local_ldf) +
+                                    " and ldelta = " +
+                                    std::to_string(local_ldelta) + ".");
+        opt.fail.append_msg(false, "Constraint: lt, ldf and ldelta >= 1.");
+        opt.fail.throw_error();
+        return;
+      }
+      double local_tol = opt.tol_value;
+      types::f77_integer local_maxit = opt.maxit_value;
+      if (local_maxit < 1) {
+        opt.fail.set_errorid(2, error_handler::ErrorCategory::Error,
+                             error_handler::ErrorType::GeneralError);
+        opt.fail.append_msg(true, "On entry, opt.maxit = " +
+                                    std::to_string(local_maxit) + ".");
+        opt.fail.append_msg(false, "Constraint: opt.maxit >= 1.");
+        opt.fail.throw_error();
+        return;
+      }
+      types::f77_integer local_n =
+        std::max(local_lt, std::max(local_ldf, local_ldelta));
+
+      data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                             typename std::remove_reference<P>::type>
+        local_p(p);
+      local_p.resize(p, local_n);
+      data_handling::RawData<types::f77_integer,
+                             data_handling::ArgIntent::IntentOUT,
+                             typename std::remove_reference<IVALID>::type>
+        local_ivalid(ivalid);
+      local_ivalid.resize(ivalid, local_n);
+
+      local_ivalid.check(opt.fail, "ivalid", true, local_n);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_p.check(opt.fail, "p", true, local_n);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_delta.check(opt.fail, "delta", true, local_ldelta);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_df.check(opt.fail, "df", true, local_ldf);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+      local_t.check(opt.fail, "t", true, local_lt);
+      if (opt.fail.error_thrown) {
+        return;
+      }
+
+      size_t lt = static_cast<size_t>(local_lt);
+      size_t ldf = static_cast<size_t>(local_ldf);
+      size_t ldelta = static_cast<size_t>(local_ldelta);
+      std::atomic<size_t> nfail(0);
+      utility::parallel_for(
+        static_cast<size_t>(local_n), opt.nthreads_value,
+        [&](size_t begin, size_t end, size_t) {
+          types::engine_data en_data;
+          engine_routines::y90haan_(en_data);
+          en_data.allocate_workspace = constants::NAG_ED_YES;
+          // only used to decode the errbuf of any failing elements
+          error_handler::ErrorHandler local_fail(
+            error_handler::ErrorHandlerType::ThrowNothing);
+          size_t local_nfail = 0;
+          for (size_t i = begin; i < end; ++i) {
+            local_fail.errorid = 0;
+            g01gbft_(en_data, local_t.data[i % lt], local_df.data[i % ldf],
+                     local_delta.data[i % ldelta], local_tol, local_maxit,
+                     local_p.data[i], local_fail.errbuf, local_fail.errorid,
+                     local_fail.errbuf_length);
+            local_ivalid.data[i] = local_fail.errorid;
+            if (local_fail.errorid != 0) {
+              local_nfail++;
+              bool is_warning = (local_fail.errorid == 3);
+              if (local_fail.errorid == 4) {
+                local_fail.populate_eb_data();
+                is_warning = (local_fail.ifmt == 99995);
+              }
+              if (!is_warning) {
+                local_p.data[i] = std::numeric_limits<double>::quiet_NaN();
+              }
+              local_fail.prepare();
+            }
+          }
+          nfail += local_nfail;
+        });
+
+      if (nfail > 0) {
+        opt.fail.set_errorid(1, error_handler::ErrorCategory::Warning,
+                             error_handler::ErrorType::GeneralWarning);
+        opt.fail.append_msg(false, "At least one element of the result could "
+                                   "not be computed exactly; see ivalid.");
+      }
+      opt.fail.throw_error();
+      if (opt.fail.error_thrown) {
+        return;
+      }
+
+      local_ivalid.copy_back(ivalid);
+      local_p.copy_back(p);
+      opt.fail.throw_warning();
+    }
+
+    // alt-1
+    template <typename T, typename DF, typename DELTA, typename P,
+              typename IVALID>
+    void prob_students_t_noncentral(const T &t, const DF &df,
+                                    const DELTA &delta, P &&p,
+                                    IVALID &&ivalid) {
+      stat::OptionalG01GB local_opt;
+
+      prob_students_t_noncentral(t, df, delta, p, ivalid, local_opt);
+    }
   }
 }
 #define g01gb stat::prob_students_t_noncentral
@@ -167,12 +167,14 @@ namespace nagcpp {
                               types::f77_integer &nsub,
                               correg::OptionalG02AK &opt) {
       opt.fail.prepare("correg::corrmat_nearest_rank (g02ak)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
                              typename std::remove_reference<G>::type>
-        local_g(g);
+        local_g(g, data_handling::UseLD());
 
       types::f77_integer local_n =
         data_handling::get_size(opt.fail, "n", local_g, 1, local_g, 2);
@@ -185,7 +187,7 @@ namespace nagcpp {
       types::f77_integer local_maxit = opt.maxit_value;
       data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
                              typename std::remove_reference<X>::type>
-        local_x(x);
+        local_x(x, data_handling::UseLD());
       local_x.resize(x, local_n, local_n);
       types::f77_integer local_storage_order =
         data_handling::get_storage_order(opt.default_to_col_major, local_g,
@@ -239,12 +239,14 @@ namespace nagcpp {
               const Y &y, types::f77_integer &ip, types::f77_integer &nstep,
               B &&b, FITSUM &&fitsum, correg::OptionalG02MA &opt) {
       opt.fail.prepare("correg::lars (g02ma)");
+      utility::ScopedWorkspaceAllocator local_allocator_scope(
+        opt.workspace_allocator.get());
       types::engine_data en_data;
       engine_routines::y90haan_(en_data);
       en_data.allocate_workspace = constants::NAG_ED_YES;
       data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<D>::type>
-        local_d(d);
+        local_d(d, data_handling::UseLD());
       data_handling::RawData<types::f77_integer,
                              data_handling::ArgIntent::IntentIN,
                              typename std::remove_reference<ISX>::type>
@@ -298,7 +300,7 @@ namespace nagcpp {
       }
       data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
                              typename std::remove_reference<B>::type>
-        local_b(b);
+        local_b(b, data_handling::UseLD());
       local_b.resize(b, vl_p, local_mnstep + 2);
       data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
                              typename std::remove_reference<FITSUM>::type>
@@ -351,6 +353,7 @@ namespace nagcpp {
                local_mnstep, ip, nstep, local_b.data, local_ldb,
                local_fitsum.data, local_ropt.data, local_lropt, local_monit,
                opt.fail.errbuf, opt.fail.errorid, opt.fail.errbuf_length);
+      opt.iomanager->flush();
 
       if (!(opt.fail.initial_error_handler(en_data))) {
         if (opt.fail.ierr == 11 && opt.fail.ifmt == 11) {
@@ -4,6 +4,7 @@
 #include "nagcpp_data_handling_base.hpp"
 #include "nagcpp_data_handling_default.hpp"
 #include "nagcpp_data_handling_std_vector.hpp"
+#include "nagcpp_data_handling_vector_view.hpp"
 #include "nagcpp_utility_array.hpp"
 
 // availability of these types is handled in the headers themselves
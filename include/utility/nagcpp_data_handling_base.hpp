@@ -3,9 +3,15 @@
 
 #include "nagcpp_consts.hpp"
 #include "nagcpp_data_handling_array_info.hpp"
+#include "nagcpp_data_handling_conversion_copies.hpp"
 #include "nagcpp_engine_types.hpp"
 #include "nagcpp_error_handler.hpp"
+#include "nagcpp_utility_allocator.hpp"
+#include "nagcpp_utility_profiler.hpp"
+#include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace nagcpp {
   namespace data_handling {
@@ -48,6 +54,11 @@ namespace nagcpp {
       return (sorder == constants::NAG_ED_COL_MAJOR) ? true : false;
     }
 
+    // passed to the RawData constructor by wrappers that pass the leading
+    // dimension of a two-dimensional argument (get_LD) to the engine, so
+    // that data that is not held contiguously can be used directly
+    struct UseLD {};
+
     // base class used when converting user supplied data
     // types into something that can be used in the wrappers
     template <typename RT, enum ArgIntent inout>
@@ -65,22 +76,51 @@ namespace nagcpp {
         size3;
       array_info<bool>
         is_col_major;
+      // leading dimension, only set for two-dimensional arrays whose
+      // elements are not held contiguously and are used directly
+      array_info<size_t>
+        ld;
+      // true if the wrapper passes the leading dimension to the engine,
+      // otherwise a packed copy is made of any data that is not held
+      // contiguously, and packed_ld holds the leading dimension of the
+      // users data
+      bool borrow_ld;
+      array_info<size_t>
+        packed_ld;
       bool col_major_is_default;
 
       bool allocated;
       array_info<size_t>
         nelements;
       RT * ldata;
+      // allocator used for ldata (nullptr if new [] was used) and the
+      // number of elements allocated
+      utility::WorkspaceAllocator *ldata_allocator;
+      size_t ldata_size;
+
+      // number of bytes copied from the users container into ldata (and
+      // identifier of the corresponding entry in the ConversionCopyLog)
+      size_t conversion_bytes;
+      mutable size_t conversion_record;
 
       protected : BaseRawData() : data(nullptr),
       ndims(0),
       size1(0),
       size2(0),
       size3(0),
+      ld(0),
+      borrow_ld(false),
+      packed_ld(0),
       col_major_is_default(true),
       allocated(false),
       nelements(0),
-      ldata(nullptr){}
+      ldata(nullptr),
+      ldata_allocator(nullptr),
+      ldata_size(0),
+      conversion_bytes(0),
+      conversion_record(no_conversion_record){}
+
+      static const size_t no_conversion_record = static_cast<size_t>(-1);
 
       virtual ~BaseRawData(){deallocate();}
 
@@ -155,7 +195,8 @@ namespace nagcpp {
       deallocate();
       if (nelements.value > 0) {
         allocated = true;
-        ldata = new RT[nelements.value];
+        ldata_size = static_cast<size_t>(nelements.value);
+        ldata = utility::allocate_workspace<RT>(ldata_size, ldata_allocator);
       }
       data = ldata;
     }
@@ -163,7 +204,7 @@ namespace nagcpp {
   private:
     void deallocate(void) {
       if (allocated) {
-        delete[] ldata;
+        utility::deallocate_workspace(ldata, ldata_size, ldata_allocator);
         allocated = false;
         ldata = nullptr;
       }
@@ -199,12 +240,54 @@ namespace nagcpp {
     }
     // ... allow for local arrays in wrappers
 
+    // set the leading dimension of a two-dimensional array ...
+    // if the data is used directly, the number of elements spanned by the
+    // array is adjusted to account for any gaps between consecutive
+    // columns (or rows), otherwise the leading dimension is recorded in
+    // packed_ld so that a packed copy can be made
+    template <typename ST>
+    void set_ld(const array_info<ST> &ld_) {
+      ld = array_info<size_t>(false);
+      packed_ld = array_info<size_t>(false);
+      if (!ld_.set || ndims != 2) {
+        return;
+      }
+      types::f77_integer nrow, ncol;
+      get_ld_shape(nrow, ncol);
+      if (ld_.value == nrow) {
+        // contiguous storage
+        return;
+      }
+      if (!borrow_ld) {
+        packed_ld = ld_.value;
+        return;
+      }
+      ld = ld_.value;
+      if (nrow > 0 && ncol > 0) {
+        nelements = ld_.value * (ncol - 1) + nrow;
+      }
+    }
+    // number of rows and columns (or columns and rows, for row major
+    // storage) of a two-dimensional array
+    void get_ld_shape(types::f77_integer &nrow,
+                      types::f77_integer &ncol) const {
+      bool this_col_major = col_major_is_default;
+      if (is_col_major.set) {
+        this_col_major = is_col_major.value;
+      }
+      nrow = this_col_major ? size1.value : size2.value;
+      ncol = this_col_major ? size2.value : size1.value;
+    }
+    // ... set the leading dimension of a two-dimensional array
+
     // lead, second and third dimensions of multi-dimensional arrays ...
     types::f77_integer get_LD(types::f77_integer sorder,
                               types::f77_integer min_ld = 0) const {
       types::f77_integer ld = 0;
       if (ndims == 2) {
-        if (sorder == constants::NAG_ED_COL_MAJOR) {
+        if (this->ld.set) {
+          return std::max(this->ld.value, min_ld);
+        } else if (sorder == constants::NAG_ED_COL_MAJOR) {
           return std::max(size1.value, min_ld);
         } else {
           return std::max(size2.value, min_ld);
@@ -244,10 +327,34 @@ namespace nagcpp {
     }
     // ... lead, second and third dimensions of multi-dimensional arrays
 
+    // log any copy made of the users data ...
+    // (the copy is made when the data is extracted from the users container,
+    // but the name of the argument is not known until check is called)
+    void log_conversion_copy(const error_handler::ErrorHandler &error_handler,
+                             const std::string &argname) const {
+#ifdef NAGCPP_TRACK_CONVERSION_COPIES
+      if (conversion_bytes > 0 && conversion_record == no_conversion_record) {
+        conversion_record = ConversionCopyLog::instance().add(
+          error_handler.fun_name, argname, conversion_bytes);
+      }
+#endif
+    }
+    void log_conversion_copy_back(size_t nbytes) const {
+#ifdef NAGCPP_TRACK_CONVERSION_COPIES
+      if (conversion_record == no_conversion_record) {
+        conversion_record =
+          ConversionCopyLog::instance().add("", "", conversion_bytes);
+      }
+      ConversionCopyLog::instance().add_bytes_out(conversion_record, nbytes);
+#endif
+    }
+    // ... log any copy made of the users data
+
     // check that the raw data is of the expected size ...
     void check(error_handler::ErrorHandler &error_handler,
                const std::string &argname, bool must_be_supplied,
                types::f77_integer esize) const {
+      log_conversion_copy(error_handler, argname);
       if (data) {
         error_handler.is_error_array_size(argname, ndims, size1, esize);
       } else if (must_be_supplied) {
@@ -258,6 +365,7 @@ namespace nagcpp {
                const std::string &argname, bool must_be_supplied,
                types::f77_integer esorder, types::f77_integer esize1,
                types::f77_integer esize2) const {
+      log_conversion_copy(error_handler, argname);
       if (data) {
         error_handler.is_error_array_size(argname, ndims, size1, esize1, size2,
                                           esize2);
@@ -276,6 +384,7 @@ namespace nagcpp {
                const std::string &argname, bool must_be_supplied,
                types::f77_integer esorder, types::f77_integer esize1,
                types::f77_integer esize2, types::f77_integer esize3) const {
+      log_conversion_copy(error_handler, argname);
       if (data) {
         error_handler.is_error_array_size(argname, ndims, size1, esize1, size2,
                                           esize2, size3, esize3);
@@ -311,9 +420,9 @@ namespace nagcpp {
         this_col_major = col_major_is_default;
       }
       if (this_col_major) {
-        return data[j * size1.value + i];
+        return data[j * (ld.set ? ld.value : size1.value) + i];
       } else {
-        return data[i * size2.value + j];
+        return data[i * (ld.set ? ld.value : size2.value) + j];
       }
     }
     template <typename IT1, typename IT2, typename IT3>
@@ -448,6 +557,75 @@ namespace nagcpp {
   struct convert_nag_array_to_user_t;
   // ... each user types needs a specialization of this template
 
+  // pool of scratch containers used when converting NAG arrays into
+  // user types inside callbacks ...
+  // a container is handed back to the pool when the object performing the
+  // conversion is destroyed, so that it can be reused by the next call to
+  // the callback, hence once the pool has warmed up no further heap
+  // allocations are required
+  // one pool is owned by each call to a NAG routine (via CallbackAddresses)
+  // and is not thread safe
+  class CallbackScratch {
+  private:
+    struct pool_base {
+      virtual ~pool_base() {}
+    };
+    template <typename VT>
+    struct pool : public pool_base {
+      std::vector<VT> available;
+    };
+    template <typename VT>
+    static const void *pool_id(void) {
+      static const char id = 0;
+      return &id;
+    }
+    std::vector<std::pair<const void *, std::unique_ptr<pool_base>>> pools;
+    size_t nallocations;
+
+    template <typename VT>
+    pool<VT> &get_pool(void) {
+      const void *id = pool_id<VT>();
+      for (auto &entry : pools) {
+        if (entry.first == id) {
+          return *static_cast<pool<VT> *>(entry.second.get());
+        }
+      }
+      pools.emplace_back(id, std::unique_ptr<pool_base>(new pool<VT>()));
+      return *static_cast<pool<VT> *>(pools.back().second.get());
+    }
+
+  public:
+    CallbackScratch() : nallocations(0) {}
+    CallbackScratch(const CallbackScratch &) = delete;
+    CallbackScratch &operator=(const CallbackScratch &) = delete;
+
+    // return a container of length n, reusing one from the pool if
+    // possible
+    template <typename VT>
+    VT acquire(size_t n) {
+      pool<VT> &p = get_pool<VT>();
+      VT v;
+      if (!p.available.empty()) {
+        v = std::move(p.available.back());
+        p.available.pop_back();
+      }
+      if (v.capacity() < n) {
+        ++nallocations;
+      }
+      v.resize(n);
+      return v;
+    }
+    // hand a container back to the pool
+    template <typename VT>
+    void release(VT &&v) {
+      get_pool<typename std::remove_reference<VT>::type>().available.push_back(
+        std::move(v));
+    }
+    // number of times a container had to be (re)allocated
+    size_t allocations(void) const { return nallocations; }
+  };
+  // ... pool of scratch containers
+
   template <typename NAT, enum ArgIntent inout, typename UAT>
   auto convert_nag_array_to_user(NAT &nag_array) -> decltype(
     convert_nag_array_to_user_t<
@@ -460,6 +638,33 @@ namespace nagcpp {
         typename std::remove_reference<UAT>::type>::type>::get(nag_array);
   }
 
+  // as above, but allows the conversion to draw on a pool of scratch
+  // containers, if the specialization for the users type supports it ...
+  template <typename CT, typename NAT>
+  inline auto get_converter(NAT &nag_array, CallbackScratch &scratch, int)
+    -> decltype(CT::get(nag_array, scratch)) {
+    return CT::get(nag_array, scratch);
+  }
+  template <typename CT, typename NAT>
+  inline auto get_converter(NAT &nag_array, CallbackScratch &scratch, long)
+    -> decltype(CT::get(nag_array)) {
+    return CT::get(nag_array);
+  }
+  template <typename NAT, enum ArgIntent inout, typename UAT>
+  auto convert_nag_array_to_user(NAT &nag_array, CallbackScratch &scratch)
+    -> decltype(get_converter<convert_nag_array_to_user_t<
+                  NAT, inout,
+                  typename std::remove_const<
+                    typename std::remove_reference<UAT>::type>::type>>(
+      nag_array, scratch, 0)) {
+    return get_converter<convert_nag_array_to_user_t<
+      NAT, inout,
+      typename std::remove_const<
+        typename std::remove_reference<UAT>::type>::type>>(nag_array, scratch,
+                                                           0);
+  }
+  // ... as above, but allows the conversion to draw on a pool
+
   // handle case of a NAG array to NAG array conversion ...
   // (i.e. user is using the NAG arrays in their callback)
 
@@ -485,7 +690,11 @@ namespace nagcpp {
 // ... code to convert NAG array types to user types
 struct CallbackAddresses {
   void **address;
-  CallbackAddresses(size_t n) { address = new void *[n]; }
+  // scratch containers reused across calls to the callbacks
+  mutable CallbackScratch scratch;
+  // timings for the callbacks (nullptr if profiling is not enabled)
+  utility::CallbackProfiler *profiler;
+  CallbackAddresses(size_t n) : profiler(nullptr) { address = new void *[n]; }
   ~CallbackAddresses() { delete[] address; }
 };
 }
@@ -6,74 +6,79 @@
 #ifdef HAVE_BOOST_MATRIX
 #include "nagcpp_data_handling_base.hpp"
 #include <boost/numeric/ublas/matrix.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace nagcpp {
   namespace data_handling {
 
-    template <typename RT, enum ArgIntent inout, typename SO>
-    class RawData<RT, inout, boost::numeric::ublas::matrix<RT, SO>>
+    // storage types whose elements are held contiguously, so the data
+    // can be passed directly to the engine ...
+    template <typename A>
+    struct is_contiguous_boost_storage : public std::false_type {};
+    template <typename T, typename ALLOC>
+    struct is_contiguous_boost_storage<
+      boost::numeric::ublas::unbounded_array<T, ALLOC>>
+      : public std::true_type {};
+    template <typename T, std::size_t N, typename ALLOC>
+    struct is_contiguous_boost_storage<
+      boost::numeric::ublas::bounded_array<T, N, ALLOC>>
+      : public std::true_type {};
+    template <typename T, typename ALLOC>
+    struct is_contiguous_boost_storage<std::vector<T, ALLOC>>
+      : public std::true_type {};
+    // ... storage types whose elements are held contiguously
+
+    template <typename RT, enum ArgIntent inout, typename SO, typename A>
+    class RawData<RT, inout, boost::numeric::ublas::matrix<RT, SO, A>>
       : public BaseRawData<RT, inout> {
         using CRT = typename add_const_if_in<RT, inout>::type;
-        using BMRT = typename boost::numeric::ublas::matrix<RT, SO>;
+        using BMRT = typename boost::numeric::ublas::matrix<RT, SO, A>;
         using BMRT_ROW = typename boost::numeric::ublas::matrix<
-          RT, boost::numeric::ublas::row_major>;
+          RT, boost::numeric::ublas::row_major, A>;
         using BMRT_COLUMN = typename boost::numeric::ublas::matrix<
-          RT, boost::numeric::ublas::column_major>;
+          RT, boost::numeric::ublas::column_major, A>;
+        using borrow_storage = is_contiguous_boost_storage<A>;
 
         public : RawData(){}
 
         RawData(const BMRT &array_container){get_data(array_container);}
+        RawData(BMRT &array_container){get_data(array_container);}
+        // boost matrices are held contiguously, so the leading dimension
+        // is always the number of rows (or columns)
+        RawData(const BMRT &array_container, UseLD){get_data(array_container);}
+        RawData(BMRT &array_container, UseLD){get_data(array_container);}
 
     virtual ~RawData(void) {}
 
     void get_data(const BMRT &array_container) {
-      // NB: getData requires the data method to be implemented, we
-      // do not check that it is, i.e. using a static_assert with
-      // has_data<AC, int> == true as the condition
-      // because we want to allow arrays to be passed as nulltpr
-      // in some circumstances - so checks for null data have
-      // to be runtime and not compile time
-      this->ndims = 2;
-      this->size1 = array_container.size1();
-      this->size2 = array_container.size2();
-      this->nelements = this->size1.value * this->size2.value;
-      this->allocate();
-
-      // as we are copying the data anyway, ideally we would
-      // always use column major order. However, multi-dimensional
-      // arrays to the algorithmic engine need to use consistent storage
-      // (i.e. they all need to either be row major order, or all
-      // column major order) - if we force these to always be
-      // column major order then that may cause issues when mixing
-      // container types
-      this->is_col_major = this_is_col_major(array_container);
-
-      if (this->is_col_major.value) {
-        for (types::f77_integer j = 0, p = 0; j < this->size2.value; ++j) {
-          for (types::f77_integer i = 0; i < this->size1.value; ++i, ++p) {
-            this->ldata[p] = array_container(i, j);
-          }
-        }
-      } else {
-        for (types::f77_integer i = 0, p = 0; i < this->size1.value; ++i) {
-          for (types::f77_integer j = 0; j < this->size2.value; ++j, ++p) {
-            this->ldata[p] = array_container(i, j);
-          }
-        }
-      }
+      // a const container can only be used directly if it is input only
+      get_data_from_container(
+        array_container,
+        std::integral_constant<bool, borrow_storage::value &&
+                                       is_in<inout>::value>());
+    }
+    void get_data(BMRT &array_container) {
+      get_data_from_container(array_container, borrow_storage());
     }
 
     template <typename DUMMY = void>
     auto resize(BMRT &array_container, types::f77_integer size1_,
                 types::f77_integer size2_) ->
       typename std::enable_if<!is_in<inout>::value, DUMMY>::type {
-      // we don't need to resize the array container at this point
-      // as the copy_back method will always be called prior to
-      // returning the results
       this->size1 = (size1_ < 0) ? 0 : size1_;
       this->size2 = (size2_ < 0) ? 0 : size2_;
       this->nelements = this->size1.value * this->size2.value;
-      this->allocate();
+      if (borrow_storage::value) {
+        // resize the container and use its memory directly
+        array_container.resize(this->size1.value, this->size2.value, false);
+        get_data(array_container);
+      } else {
+        // we don't need to resize the array container at this point
+        // as the copy_back method will always be called prior to
+        // returning the results
+        this->allocate();
+      }
     }
 
     template <typename DUMMY = void>
@@ -91,6 +96,16 @@ namespace nagcpp {
       types::f77_integer rn1 = (size1_ < 0) ? 0 : size1_;
       types::f77_integer rn2 = (size2_ < 0) ? 0 : size2_;
 
+      if (uses_storage_of(array_container)) {
+        // results are already in the container, the resize preserves
+        // the (i, j)th elements
+        if (static_cast<types::f77_integer>(array_container.size1()) != rn1 ||
+            static_cast<types::f77_integer>(array_container.size2()) != rn2) {
+          array_container.resize(rn1, rn2, true);
+        }
+        return;
+      }
+
       array_container.resize(rn1, rn2);
 
       // size1_ and size2_ should always be <= the values stored in this, but just in case ...
@@ -100,21 +115,92 @@ namespace nagcpp {
       if (this->is_col_major.value) {
         for (types::f77_integer j = 0, p = 0; j < cn2; ++j) {
           for (types::f77_integer i = 0; i < cn1; ++i, ++p) {
-            array_container(i, j) = this->ldata[p];
+            array_container(i, j) = this->data[p];
           }
           p += (this->size1.value - cn1);
         }
       } else {
         for (types::f77_integer i = 0, p = 0; i < cn1; ++i) {
           for (types::f77_integer j = 0; j < cn2; ++j, ++p) {
-            array_container(i, j) = this->ldata[p];
+            array_container(i, j) = this->data[p];
           }
           p += (this->size2.value - cn2);
         }
       }
+      if (this->allocated) {
+        this->log_conversion_copy_back(static_cast<size_t>(cn1 * cn2) *
+                                       sizeof(RT));
+      }
     }
 
   private:
+    template <typename CBMRT>
+    void get_data_from_container(CBMRT &array_container, std::true_type) {
+      // contiguous storage, pass the address of the first element
+      // directly to the engine
+      this->ndims = 2;
+      this->size1 = array_container.size1();
+      this->size2 = array_container.size2();
+      this->nelements = this->size1.value * this->size2.value;
+      this->is_col_major = this_is_col_major(array_container);
+      if (this->nelements.value > 0) {
+        this->data = &(*array_container.data().begin());
+      } else {
+        this->data = nullptr;
+      }
+    }
+
+    template <typename CBMRT>
+    void get_data_from_container(CBMRT &array_container, std::false_type) {
+      // NB: getData requires the data method to be implemented, we
+      // do not check that it is, i.e. using a static_assert with
+      // has_data<AC, int> == true as the condition
+      // because we want to allow arrays to be passed as nulltpr
+      // in some circumstances - so checks for null data have
+      // to be runtime and not compile time
+      static_assert(allow_conversion_copy<BMRT>::value,
+                    "a copy of the data held in this container type is "
+                    "required, but NAGCPP_FORBID_CONVERSION_COPIES is "
+                    "defined (see nagcpp_data_handling_conversion_copies.hpp)");
+      this->ndims = 2;
+      this->size1 = array_container.size1();
+      this->size2 = array_container.size2();
+      this->nelements = this->size1.value * this->size2.value;
+      this->allocate();
+
+      // as we are copying the data anyway, ideally we would
+      // always use column major order. However, multi-dimensional
+      // arrays to the algorithmic engine need to use consistent storage
+      // (i.e. they all need to either be row major order, or all
+      // column major order) - if we force these to always be
+      // column major order then that may cause issues when mixing
+      // container types
+      this->is_col_major = this_is_col_major(array_container);
+
+      if (this->is_col_major.value) {
+        for (types::f77_integer j = 0, p = 0; j < this->size2.value; ++j) {
+          for (types::f77_integer i = 0; i < this->size1.value; ++i, ++p) {
+            this->ldata[p] = array_container(i, j);
+          }
+        }
+      } else {
+        for (types::f77_integer i = 0, p = 0; i < this->size1.value; ++i) {
+          for (types::f77_integer j = 0; j < this->size2.value; ++j, ++p) {
+            this->ldata[p] = array_container(i, j);
+          }
+        }
+      }
+      this->conversion_bytes =
+        static_cast<size_t>(this->nelements.value) * sizeof(RT);
+    }
+
+    bool uses_storage_of(const BMRT &array_container) const {
+      return (!this->allocated && this->data &&
+              array_container.size1() * array_container.size2() > 0 &&
+              static_cast<const void *>(this->data) ==
+                static_cast<const void *>(&(*array_container.data().begin())));
+    }
+
     inline static bool this_is_col_major(const BMRT_COLUMN &array_container) {
       return true;
     }
@@ -0,0 +1,108 @@
+#ifndef NAGCPP_DATA_HANDLING_CONVERSION_COPIES_HPP
+#define NAGCPP_DATA_HANDLING_CONVERSION_COPIES_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// RawData passes the address of the users data directly to the engine
+// whenever the element type of the users container matches the type expected
+// by the engine. If it does not (for example, a container of float passed
+// where the engine expects double) a local copy of the data is made, and,
+// for output arguments, copied back after the call.
+//
+// Compile with NAGCPP_FORBID_CONVERSION_COPIES defined to turn any such
+// copy into a compilation error. Copies can be re-enabled for individual
+// container types by specializing allow_conversion_copy, i.e.
+//   namespace nagcpp { namespace data_handling {
+//     template <>
+//     struct allow_conversion_copy<std::vector<float>> : std::true_type {};
+//   }}
+//
+// Compile with NAGCPP_TRACK_CONVERSION_COPIES defined to record every copy
+// made, see get_conversion_copies and reset_conversion_copies.
+namespace nagcpp {
+  namespace data_handling {
+    // whether RawData is allowed to copy data held in a container of
+    // type AC ...
+#ifdef NAGCPP_FORBID_CONVERSION_COPIES
+    template <typename AC>
+    struct allow_conversion_copy : public std::false_type {};
+#else
+    template <typename AC>
+    struct allow_conversion_copy : public std::true_type {};
+#endif
+    // ... whether RawData is allowed to copy data
+
+    // record of the copies made for a single argument of a single routine
+    struct ConversionCopyRecord {
+      std::string routine;
+      std::string argname;
+      size_t ncopies;
+      size_t bytes_in;
+      size_t bytes_out;
+    };
+
+    // thread safe log of all copies made ...
+    // (only populated when NAGCPP_TRACK_CONVERSION_COPIES is defined)
+    class ConversionCopyLog {
+    private:
+      std::mutex mtx;
+      std::vector<ConversionCopyRecord> records;
+
+      ConversionCopyLog() {}
+
+    public:
+      ConversionCopyLog(const ConversionCopyLog &) = delete;
+      ConversionCopyLog &operator=(const ConversionCopyLog &) = delete;
+
+      static ConversionCopyLog &instance(void) {
+        static ConversionCopyLog log;
+        return log;
+      }
+
+      // record that bytes_in bytes were copied for argument argname of
+      // routine, returns an identifier used by add_bytes_out
+      size_t add(const std::string &routine, const std::string &argname,
+                 size_t bytes_in) {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (size_t i = 0; i < records.size(); ++i) {
+          if (records[i].routine == routine && records[i].argname == argname) {
+            records[i].ncopies++;
+            records[i].bytes_in += bytes_in;
+            return i;
+          }
+        }
+        records.push_back({routine, argname, 1, bytes_in, 0});
+        return records.size() - 1;
+      }
+      // record that bytes_out bytes were copied back into the users
+      // container
+      void add_bytes_out(size_t id, size_t bytes_out) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (id < records.size()) {
+          records[id].bytes_out += bytes_out;
+        }
+      }
+      std::vector<ConversionCopyRecord> get(void) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return records;
+      }
+      void reset(void) {
+        std::lock_guard<std::mutex> lock(mtx);
+        records.clear();
+      }
+    };
+    // ... thread safe log of all copies made
+
+    inline std::vector<ConversionCopyRecord> get_conversion_copies(void) {
+      return ConversionCopyLog::instance().get();
+    }
+    inline void reset_conversion_copies(void) {
+      ConversionCopyLog::instance().reset();
+    }
+  }
+}
+#endif
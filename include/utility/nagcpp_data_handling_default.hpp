@@ -134,6 +134,24 @@ namespace nagcpp {
     }
     // ... storage order for multi-dimensional array of class M
 
+    // leading dimension of a two-dimensional array of class M ...
+    // looks for M.ld() first, then M.stride()
+    // (only required if the data is not held contiguously, for example
+    // when M is a view onto a block of a larger matrix)
+    template <typename M>
+    inline auto getLD(M &m, int) -> array_info<decltype(m.ld())> {
+      return array_info<decltype(m.ld())>(true, m.ld());
+    }
+    template <typename M, typename D>
+    inline auto getLD(M &m, D d) -> array_info<decltype(m.stride())> {
+      return array_info<decltype(m.stride())>(true, m.stride());
+    }
+    template <typename M>
+    inline auto getLD(M &m, long) -> array_info<types::f77_integer> {
+      return array_info<types::f77_integer>(false);
+    }
+    // ... leading dimension of a two-dimensional array of class M
+
     // resize an array ...
     template <typename V>
     inline auto resize1D(V &v, types::size_type d1, int)
@@ -192,6 +210,17 @@ namespace nagcpp {
       RawData() {}
 
       RawData(const AC &array_container) { get_data(array_container); }
+      RawData(typename std::remove_const<AC>::type &array_container) {
+        get_data(array_container);
+      }
+      RawData(const AC &array_container, UseLD) {
+        this->borrow_ld = true;
+        get_data(array_container);
+      }
+      RawData(typename std::remove_const<AC>::type &array_container, UseLD) {
+        this->borrow_ld = true;
+        get_data(array_container);
+      }
 
       // allow for local arrays via constructor in wrappers ...
       // (this type of construction will only happen with AC
@@ -210,6 +239,17 @@ namespace nagcpp {
       virtual ~RawData(void) {}
 
       void get_data(const AC &array_container) {
+        get_data_from_container(array_container);
+      }
+      void get_data(typename std::remove_const<AC>::type &array_container) {
+        // non-const access allows output arguments to use the memory
+        // held by the users container directly
+        get_data_from_container(array_container);
+      }
+
+    private:
+      template <typename CAC>
+      void get_data_from_container(CAC &array_container) {
         // NB: getData requires the data method to be implemented, we
         // do not check that it is, i.e. using a static_assert with
         // has_data<AC, int> == true as the condition
@@ -228,7 +268,9 @@ namespace nagcpp {
               this->is_col_major = sorder.value;
             }
             this->nelements *= this->size2;
-            if (this->ndims > 2) {
+            if (this->ndims == 2) {
+              this->set_ld(getLD(array_container, 0));
+            } else if (this->ndims > 2) {
               this->size3 = getDim3(array_container, 0);
               this->nelements *= this->size3;
             }
@@ -237,6 +279,8 @@ namespace nagcpp {
         }
       }
 
+    public:
+
       // resize the array container ...
       // this should resize this->data, as opposed to array_container
       // (i.e. if there is a local array (in say this->ldata) and
@@ -319,26 +363,90 @@ namespace nagcpp {
       // ... resize output container and copy back data
 
     private:
-      void convert_to_rt(RT *const user_raw_data) {
+      // the users data can be passed directly to the engine if it is held
+      // as RT and, unless it is input only, is not const
+      template <typename URT>
+      struct can_borrow
+        : public std::integral_constant<
+            bool, std::is_same<typename std::remove_const<URT>::type,
+                               typename std::remove_const<RT>::type>::value &&
+                    (is_in<inout>::value || !std::is_const<URT>::value)> {};
+
+      template <typename URT>
+      void convert_to_rt(URT *const user_raw_data) {
+        if (this->packed_ld.set) {
+          pack_strided(user_raw_data);
+        } else {
+          convert_to_rt(user_raw_data, can_borrow<URT>());
+        }
+      }
+
+      // copy data that is not held contiguously into a packed local array
+      // (the wrapper does not pass a leading dimension to the engine)
+      template <typename URT>
+      void pack_strided(URT *const user_raw_data) {
+        if (this->nelements.set && user_raw_data) {
+          this->allocate();
+          types::f77_integer nrow, ncol;
+          this->get_ld_shape(nrow, ncol);
+          for (types::f77_integer j = 0; j < ncol; j++) {
+            for (types::f77_integer i = 0; i < nrow; i++) {
+              this->ldata[j * nrow + i] = static_cast<RT>(
+                user_raw_data[j * this->packed_ld.value + i]);
+            }
+          }
+          this->conversion_bytes =
+            static_cast<size_t>(this->nelements.value) * sizeof(RT);
+        }
+      }
+
+      template <typename URT>
+      void convert_to_rt(URT *const user_raw_data, std::true_type) {
         this->data = user_raw_data;
       }
 
       template <typename URT>
-      void convert_to_rt(const URT *const user_raw_data) {
+      void convert_to_rt(URT *const user_raw_data, std::false_type) {
+        static_assert(allow_conversion_copy<AC>::value,
+                      "a copy of the data held in this container type is "
+                      "required, but NAGCPP_FORBID_CONVERSION_COPIES is "
+                      "defined (see nagcpp_data_handling_conversion_copies.hpp)");
         if (this->nelements.set && user_raw_data) {
           this->allocate();
           for (types::f77_integer i = 0; i < this->nelements.value; i++) {
-            this->ldata[i] = static_cast<URT>(user_raw_data[i]);
+            this->ldata[i] = static_cast<RT>(user_raw_data[i]);
           }
+          this->conversion_bytes =
+            static_cast<size_t>(this->nelements.value) * sizeof(RT);
         }
       }
 
       template <typename URT>
       void copy_back_and_cast(URT *const user_raw_data) const {
-        if (this->allocated && user_raw_data) {
+        if (this->allocated && user_raw_data && this->packed_ld.set) {
+          types::f77_integer nrow, ncol;
+          this->get_ld_shape(nrow, ncol);
+          for (types::f77_integer j = 0; j < ncol; j++) {
+            for (types::f77_integer i = 0; i < nrow; i++) {
+              user_raw_data[j * this->packed_ld.value + i] =
+                static_cast<URT>(this->ldata[j * nrow + i]);
+            }
+          }
+          this->log_conversion_copy_back(
+            static_cast<size_t>(this->nelements.value) * sizeof(RT));
+        } else if (this->allocated && user_raw_data) {
           for (types::f77_integer i = 0; i < this->nelements.value; i++) {
             user_raw_data[i] = static_cast<URT>(this->ldata[i]);
           }
+          this->log_conversion_copy_back(
+            static_cast<size_t>(this->nelements.value) * sizeof(RT));
+        } else if (this->data && user_raw_data &&
+                   static_cast<const void *>(user_raw_data) !=
+                     static_cast<const void *>(this->data)) {
+          // data was borrowed from a different container
+          for (types::f77_integer i = 0; i < this->nelements.value; i++) {
+            user_raw_data[i] = static_cast<URT>(this->data[i]);
+          }
         }
       }
     };
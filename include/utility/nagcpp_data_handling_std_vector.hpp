@@ -4,6 +4,8 @@
 #include "nagcpp_data_handling_base.hpp"
 #include "nagcpp_utility_array.hpp"
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace nagcpp {
   namespace data_handling {
@@ -20,30 +22,53 @@ namespace nagcpp {
 
     private:
       NART &nag_array;
+      CallbackScratch *scratch;
+      bool active;
       VRT vector;
 
     public:
-      nag_1D_array_to_std_vector(NART &nag_array_) : nag_array(nag_array_) {
+      nag_1D_array_to_std_vector(NART &nag_array_,
+                                 CallbackScratch *scratch_ = nullptr)
+        : nag_array(nag_array_), scratch(scratch_), active(true) {
         copy_in();
       }
-      ~nag_1D_array_to_std_vector() { copy_back(); }
+      nag_1D_array_to_std_vector(nag_1D_array_to_std_vector &&other)
+        : nag_array(other.nag_array), scratch(other.scratch),
+          active(other.active), vector(std::move(other.vector)) {
+        other.active = false;
+      }
+      ~nag_1D_array_to_std_vector() {
+        if (active) {
+          copy_back();
+          if (scratch) {
+            scratch->release(std::move(vector));
+          }
+        }
+      }
 
       CVRT &get(void) { return vector; }
 
     private:
+      void get_vector(size_t n) {
+        if (scratch) {
+          vector = scratch->acquire<VRT>(n);
+        } else {
+          vector.resize(n);
+        }
+      }
       template <typename DUMMY = void>
       auto copy_in(void) ->
         typename std::enable_if<is_out<inout>::value, DUMMY>::type {
         // OUT version
         size_t n = static_cast<size_t>(nag_array.size1());
-        vector.resize(n);
+        get_vector(n);
       }
       template <typename DUMMY = void>
       auto copy_in(void) ->
         typename std::enable_if<!is_out<inout>::value, DUMMY>::type {
         // IN and INOUT version
         size_t n = static_cast<size_t>(nag_array.size1());
-        vector.resize(n);
+        get_vector(n);
         for (size_t i = 0; i < n; ++i) {
           vector[i] = nag_array(i);
         }
@@ -72,15 +97,25 @@ namespace nagcpp {
       static nag_1D_array_to_std_vector<RT, inout, ALLOCATOR> get(
         utility::array1D<RT, inout> &nag_array){
         return nag_1D_array_to_std_vector<RT, inout, ALLOCATOR>(nag_array);}
+      static nag_1D_array_to_std_vector<RT, inout, ALLOCATOR> get(
+        utility::array1D<RT, inout> &nag_array, CallbackScratch &scratch){
+        return nag_1D_array_to_std_vector<RT, inout, ALLOCATOR>(nag_array,
+                                                               &scratch);}
   };
 
   template <typename RT, typename ALLOCATOR>
   struct convert_nag_array_to_user_t<const utility::array1D<RT, IntentIN>, IntentIN,
                                      std::vector<RT, ALLOCATOR>> {
-    static const nag_1D_array_to_std_vector<RT, IntentIN, ALLOCATOR>
+    static nag_1D_array_to_std_vector<RT, IntentIN, ALLOCATOR>
       get(const utility::array1D<RT, IntentIN> &nag_array) {
       return nag_1D_array_to_std_vector<RT, IntentIN, ALLOCATOR>(nag_array);
     }
+    static nag_1D_array_to_std_vector<RT, IntentIN, ALLOCATOR>
+      get(const utility::array1D<RT, IntentIN> &nag_array,
+          CallbackScratch &scratch) {
+      return nag_1D_array_to_std_vector<RT, IntentIN, ALLOCATOR>(nag_array,
+                                                                 &scratch);
+    }
   };
   // ... handle conversion of NAG array to std::vector
 }
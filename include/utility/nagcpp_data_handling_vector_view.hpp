@@ -0,0 +1,101 @@
+#ifndef NAGCPP_DATA_HANDLING_VECTOR_VIEW_HPP
+#define NAGCPP_DATA_HANDLING_VECTOR_VIEW_HPP
+
+#include "nagcpp_data_handling_base.hpp"
+#include "nagcpp_utility_array.hpp"
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+#if defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#define NAGCPP_HAVE_STD_SPAN
+#endif
+#endif
+#endif
+
+namespace nagcpp {
+  namespace data_handling {
+    // we don't need a RawData specialization as the default works for
+    // vector_view (and std::span)
+
+    // handle conversion of NAG array to a non-owning view ...
+    // the view points directly at the memory held by the NAG array, so
+    // no allocation or copying takes place (and nothing needs to be
+    // copied back on destruction)
+    template <typename VT>
+    class nag_1D_array_to_view {
+    private:
+      VT view;
+
+    public:
+      template <typename NAT>
+      nag_1D_array_to_view(NAT &nag_array)
+        : view(nag_array.data(), static_cast<size_t>(nag_array.size1())) {}
+
+      VT &get(void) { return view; }
+    };
+
+    template <typename RT, enum ArgIntent inout>
+    struct convert_nag_array_to_user_t<utility::array1D<RT, inout>, inout,
+                                       utility::vector_view<RT>> {
+      static nag_1D_array_to_view<utility::vector_view<RT>>
+        get(utility::array1D<RT, inout> &nag_array) {
+        return nag_1D_array_to_view<utility::vector_view<RT>>(nag_array);
+      }
+    };
+
+    template <typename RT, enum ArgIntent inout>
+    struct convert_nag_array_to_user_t<utility::array1D<RT, inout>, inout,
+                                       utility::vector_view<const RT>> {
+      static nag_1D_array_to_view<utility::vector_view<const RT>>
+        get(utility::array1D<RT, inout> &nag_array) {
+        return nag_1D_array_to_view<utility::vector_view<const RT>>(
+          nag_array);
+      }
+    };
+
+    template <typename RT>
+    struct convert_nag_array_to_user_t<const utility::array1D<RT, IntentIN>,
+                                       IntentIN,
+                                       utility::vector_view<const RT>> {
+      static nag_1D_array_to_view<utility::vector_view<const RT>>
+        get(const utility::array1D<RT, IntentIN> &nag_array) {
+        return nag_1D_array_to_view<utility::vector_view<const RT>>(
+          nag_array);
+      }
+    };
+
+#ifdef NAGCPP_HAVE_STD_SPAN
+    template <typename RT, enum ArgIntent inout>
+    struct convert_nag_array_to_user_t<utility::array1D<RT, inout>, inout,
+                                       std::span<RT>> {
+      static nag_1D_array_to_view<std::span<RT>>
+        get(utility::array1D<RT, inout> &nag_array) {
+        return nag_1D_array_to_view<std::span<RT>>(nag_array);
+      }
+    };
+
+    template <typename RT, enum ArgIntent inout>
+    struct convert_nag_array_to_user_t<utility::array1D<RT, inout>, inout,
+                                       std::span<const RT>> {
+      static nag_1D_array_to_view<std::span<const RT>>
+        get(utility::array1D<RT, inout> &nag_array) {
+        return nag_1D_array_to_view<std::span<const RT>>(nag_array);
+      }
+    };
+
+    template <typename RT>
+    struct convert_nag_array_to_user_t<const utility::array1D<RT, IntentIN>,
+                                       IntentIN, std::span<const RT>> {
+      static nag_1D_array_to_view<std::span<const RT>>
+        get(const utility::array1D<RT, IntentIN> &nag_array) {
+        return nag_1D_array_to_view<std::span<const RT>>(nag_array);
+      }
+    };
+#endif
+    // ... handle conversion of NAG array to a non-owning view
+  }
+}
+
+#endif
@@ -2,7 +2,10 @@
 #define NAGCPP_ERROR_HANDLER_HPP
 
 #include <algorithm>
-#include <regex>
+#include <climits>
+#include <cctype>
+#include <cstring>
+#include <exception>
 #include <string>
 #include <vector>
 
@@ -186,6 +189,81 @@ namespace nagcpp {
                                                       : "Row Major Order");
     }
 
+    // split the contents of errbuf into fields separated by errbuf_delim ...
+    // the fields are returned one at a time as pointers into errbuf, so no
+    // memory is allocated. Empty fields are returned, except for a trailing
+    // one (i.e. the same fields as a std::sregex_token_iterator with a
+    // submatch of -1)
+    class ErrbufTokenizer {
+    private:
+      const char *pos;
+      const char *end;
+      bool done;
+
+    public:
+      ErrbufTokenizer(const char *errbuf, size_t max_length)
+        : pos(errbuf), end(errbuf), done(false) {
+        while (static_cast<size_t>(end - errbuf) < max_length && *end != '\0') {
+          ++end;
+        }
+      }
+      // get the next field, returns false if there are no more fields
+      bool next(const char *&start, size_t &length) {
+        if (done) {
+          return false;
+        }
+        start = pos;
+        const char *delim =
+          static_cast<const char *>(std::memchr(pos, errbuf_delim, end - pos));
+        if (delim) {
+          length = static_cast<size_t>(delim - pos);
+          pos = delim + 1;
+          return true;
+        }
+        length = static_cast<size_t>(end - pos);
+        pos = end;
+        done = true;
+        return (length > 0);
+      }
+    };
+    // ... split the contents of errbuf into fields
+
+    // convert a field from errbuf into an int, the same values as std::stoi
+    // are accepted (leading white space, an optional sign, at least one digit
+    // and any trailing characters are ignored)
+    // returns false if the field does not hold a valid int
+    inline bool errbuf_field_to_int(const char *start, size_t length,
+                                    int &value) {
+      size_t i = 0;
+      while (i < length && std::isspace(static_cast<unsigned char>(start[i]))) {
+        ++i;
+      }
+      bool negative = false;
+      if (i < length && (start[i] == '-' || start[i] == '+')) {
+        negative = (start[i] == '-');
+        ++i;
+      }
+      if (i == length || !std::isdigit(static_cast<unsigned char>(start[i]))) {
+        return false;
+      }
+      long long ivalue = 0;
+      for (; i < length && std::isdigit(static_cast<unsigned char>(start[i]));
+           ++i) {
+        ivalue = 10 * ivalue + (start[i] - '0');
+        if (ivalue > static_cast<long long>(INT_MAX) + 1) {
+          return false;
+        }
+      }
+      if (negative) {
+        ivalue = -ivalue;
+      }
+      if (ivalue > INT_MAX || ivalue < INT_MIN) {
+        return false;
+      }
+      value = static_cast<int>(ivalue);
+      return true;
+    }
+
     class ErrorHandlerControl {
     public:
       // class that holds the global error handling control arguments
@@ -288,7 +366,8 @@ namespace nagcpp {
         last_pos = 0;
         last_fixed = false;
         // reset the error handler back to indicating no error
-        prepare(fun_name);
+        errbuf_present = true;
+        clear();
       }
       // ... methods that a user may want to call
       // all other public classes are only public to allow them to be used directly
@@ -380,23 +459,49 @@ namespace nagcpp {
       // ... methods to generate the error message string
 
     public:
-      void prepare(std::string fun_name_ = "", bool errbuf_present_ = true) {
-        fun_name = fun_name_;
+      // called on entry to every wrapper, so kept as cheap as possible:
+      // fun_name is only reassigned if it has changed and the error state
+      // is only cleared if the previous call left something behind
+      void prepare(const char *fun_name_ = "", bool errbuf_present_ = true) {
+        if (fun_name.compare(fun_name_) != 0) {
+          fun_name.assign(fun_name_);
+        }
         errbuf_present = errbuf_present_;
+        if (has_state()) {
+          clear();
+        }
+      }
+      void prepare(const std::string &fun_name_,
+                   bool errbuf_present_ = true) {
+        prepare(fun_name_.c_str(), errbuf_present_);
+      }
+
+      void set_calling_function(std::string fun_name_) { fun_name = fun_name_; }
+
+    private:
+      // true if any of the error information differs from its cleared value
+      bool has_state(void) const {
+        return (errorid != IERR_SUCCESS || ierr != 0 || ifmt != 0 ||
+                category != ErrorCategory::None ||
+                type != ErrorType::NoError || error_thrown ||
+                warning_thrown || contact_nag || errbuf[0] != '\0' ||
+                !msg.empty() || !eb_data.empty());
+      }
+      void clear(void) {
         ierr = 0;
         ifmt = 0;
-        msg = "";
+        msg.clear();
         type = ErrorType::NoError;
         category = ErrorCategory::None;
         errorid = IERR_SUCCESS;
         eb_data.clear();
-        std::memset(errbuf, '\0', 201 * sizeof(char));
+        std::memset(errbuf, '\0', (errbuf_length + 1) * sizeof(char));
         contact_nag = false;
         error_thrown = false;
         warning_thrown = false;
       }
 
-      void set_calling_function(std::string fun_name_) { fun_name = fun_name_; }
+    public:
 
       bool initial_error_handler(types::engine_data &en_data) {
         // handle common errors. if the error is not a common one, then
@@ -804,47 +909,55 @@ namespace nagcpp {
           return internal_error;
         }
 
-        try {
-          // tokenize errbuf
-          std::regex reg(std::string(1, errbuf_delim));
-          std::string serrbuf(errbuf);
-          std::sregex_token_iterator iter(serrbuf.begin(), serrbuf.end(), reg,
-                                          -1);
-          std::sregex_token_iterator end;
-
-          // skip any blank entries at the start
-          for (; iter != end && *iter == ""; iter++)
-            ;
-
-          // first two elements of errbuf are integer codes
-          if (iter != end) {
-            ierr = std::stoi((*iter).str());
-            iter++;
+        ErrbufTokenizer tokens(errbuf, errbuf_length + 1);
+        const char *start = nullptr;
+        size_t length = 0;
+        bool more = tokens.next(start, length);
+
+        // skip any blank entries at the start
+        while (more && length == 0) {
+          more = tokens.next(start, length);
+        }
+
+        // first two elements of errbuf are integer codes, the third is a
+        // count of data items
+        int codes[3];
+        int ncodes = 0;
+        for (; more && ncodes < 3; ++ncodes) {
+          if (!errbuf_field_to_int(start, length, codes[ncodes])) {
+            internal_error = true;
+            break;
           }
-          if (iter != end) {
-            ifmt = std::stoi((*iter).str());
-            iter++;
+          if (ncodes == 0) {
+            ierr = codes[0];
+          } else if (ncodes == 1) {
+            ifmt = codes[1];
           }
-          // third element of errbuf is a count of data items
-          if (iter != end) {
-            int ndata = std::stoi((*iter).str());
-            iter++;
-            if (ndata > 0) {
-              // get the rest of the data items
-              eb_data.assign(iter, end);
-              // we are truncating if ndata < number of data items supplied
-              // padding with the unknown data message if ndata > number of data
-              // items (neither of these case should occur)
-              eb_data.resize(ndata, unknown_data_msg);
+          more = tokens.next(start, length);
+        }
+        if (!internal_error && ncodes < 3) {
+          // errbuf doesn't contain at least three values (should never
+          // happen)
+          internal_error = true;
+        }
+        if (!internal_error && codes[2] > 0) {
+          size_t ndata = static_cast<size_t>(codes[2]);
+          try {
+            // get the rest of the data items
+            // we are truncating if ndata < number of data items supplied
+            // padding with the unknown data message if ndata > number of data
+            // items (neither of these case should occur)
+            eb_data.clear();
+            for (; more && eb_data.size() < ndata;
+                 more = tokens.next(start, length)) {
+              eb_data.emplace_back(start, length);
             }
-          } else {
-            // errbuf doesn't contain at least three values (should never
+            eb_data.resize(ndata, unknown_data_msg);
+          } catch (...) {
+            // something has gone wrong allocating eb_data (should never
             // happen)
             internal_error = true;
           }
-        } catch (...) {
-          // something has gone wrong parsing errbuf (should never happen)
-          internal_error = true;
         }
 
         if (internal_error) {
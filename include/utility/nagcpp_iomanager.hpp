@@ -8,7 +8,10 @@
 #include <ios>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace nagcpp {
@@ -37,6 +40,16 @@ namespace nagcpp {
                              const std::string &rec) {
         std::cout << rec << std::endl;
       }
+      // print a record of length characters, called by utility::print_rech
+      // for the records produced by the engine. Overriding this avoids
+      // constructing a std::string for each record
+      virtual void print_rec_chars(const types::f77_integer unit_number,
+                                   const char *rec, const size_t length) {
+        print_rec(unit_number, std::string(rec, length));
+      }
+      // write out any records held back by the IOManager, called by the
+      // wrappers once the engine has returned
+      virtual void flush(void) {}
       virtual types::f77_integer read_rec(const types::f77_integer unit_number,
                                           std::string &rec,
                                           const types::f77_integer nchar = -1) {
@@ -103,8 +116,14 @@ namespace nagcpp {
     const types::f77_integer IOManagerBase::err_unit_number;
 
     // main IOManager
+    // registering, deregistering and looking up streams is thread safe,
+    // so an IOManager can be shared by solves running in different
+    // threads, however records sent to the same stream from more than one
+    // thread may be interleaved
     class IOManager : public IOManagerBase {
     private:
+      // guards unit_store_o, unit_store_i, max_used_o and max_used_i
+      std::mutex registry_mtx;
       std::map<types::f77_integer, std::basic_ostream<char> *> unit_store_o;
       std::map<types::f77_integer, std::basic_istream<char> *> unit_store_i;
       types::f77_integer max_used_o;
@@ -124,64 +143,68 @@ namespace nagcpp {
         initialise_error_message_unit();
       }
       ~IOManager() {}
+
+      // an IOManager for the calling thread
+      static std::shared_ptr<IOManager> thread_local_instance(void) {
+        static thread_local std::shared_ptr<IOManager> iomanager =
+          std::make_shared<IOManager>();
+        return iomanager;
+      }
       types::f77_integer register_istream(std::istream &is_to_register) {
         // register an input stream for use
+        std::lock_guard<std::mutex> lock(registry_mtx);
         return register_stream(is_to_register, unit_store_i, true, max_used_i,
                                min_unit_number_i, max_unit_number_i);
       }
       types::f77_integer register_ostream(std::ostream &os_to_register) {
         // register an output stream for use
+        std::lock_guard<std::mutex> lock(registry_mtx);
         return register_stream(os_to_register, unit_store_o, false, max_used_o,
                                min_unit_number_o, max_unit_number_o);
       }
       void deregister_istream(types::f77_integer unit_number) {
-        (void)deregister_stream(unit_number, unit_store_i);
+        {
+          std::lock_guard<std::mutex> lock(registry_mtx);
+          (void)deregister_stream(unit_number, unit_store_i);
+        }
         reset_standard_channels(unit_number);
       }
       void deregister_istream(std::istream &is_to_deregister) {
-        types::f77_integer unit_number =
-          deregister_stream(is_to_deregister, unit_store_i);
+        types::f77_integer unit_number;
+        {
+          std::lock_guard<std::mutex> lock(registry_mtx);
+          unit_number = deregister_stream(is_to_deregister, unit_store_i);
+        }
         reset_standard_channels(unit_number);
       }
       void deregister_ostream(types::f77_integer unit_number) {
+        std::lock_guard<std::mutex> lock(registry_mtx);
         (void)deregister_stream(unit_number, unit_store_o);
       }
       void deregister_ostream(std::ostream &os_to_deregister) {
+        std::lock_guard<std::mutex> lock(registry_mtx);
         (void)deregister_stream(os_to_deregister, unit_store_o);
       }
       types::f77_integer unit_from_istream(std::istream &is_of_interest) {
+        std::lock_guard<std::mutex> lock(registry_mtx);
         return unit_from_stream(is_of_interest, unit_store_i);
       }
       std::istream &istream_from_unit(types::f77_integer unit_number) {
-        auto iter = unit_store_i.find(unit_number);
-        if (iter == unit_store_i.end()) {
-          // no stream associated with unit_number - throw exception
-          throw std::ios_base::failure("No registered istream associated with "
-                                       "input unit number " +
-                                       std::to_string(unit_number) + ".");
-        }
-        return *(iter->second);
+        std::lock_guard<std::mutex> lock(registry_mtx);
+        return find_stream(unit_number, unit_store_i, "istream", "input");
       }
       types::f77_integer unit_from_ostream(std::ostream &os_of_interest) {
+        std::lock_guard<std::mutex> lock(registry_mtx);
         return unit_from_stream(os_of_interest, unit_store_o);
       }
       std::ostream &ostream_from_unit(types::f77_integer unit_number) {
-        auto iter = unit_store_o.find(unit_number);
-        if (iter == unit_store_o.end()) {
-          // no stream associated with unit_number - throw exception
-          throw std::ios_base::failure("No registered ostream associated with "
-                                       "output unit number " +
-                                       std::to_string(unit_number) + ".");
-        }
-        return *(iter->second);
+        std::lock_guard<std::mutex> lock(registry_mtx);
+        return find_stream(unit_number, unit_store_o, "ostream", "output");
       }
       void register_to_advisory_message_unit(std::ostream &os_to_register) {
         // register an I stream to use for advisory messages
-        auto iter = unit_store_o.find(adv_unit_number);
-        if (iter == unit_store_o.end()) {
-          initialise_advisory_message_unit(os_to_register);
-        }
-        iter->second = &os_to_register;
+        std::lock_guard<std::mutex> lock(registry_mtx);
+        initialise_advisory_message_unit(os_to_register);
       }
       void reset_advisory_message_unit(void) {
         // reset the stream used for advisory messages (to std::cout)
@@ -189,12 +212,8 @@ namespace nagcpp {
       }
       void register_to_error_message_unit(std::ostream &os_to_register) {
         // register an I stream to use for error messages
-        auto iter = unit_store_o.find(err_unit_number);
-        if (iter == unit_store_o.end()) {
-          initialise_error_message_unit(os_to_register);
-        } else {
-          iter->second = &os_to_register;
-        }
+        std::lock_guard<std::mutex> lock(registry_mtx);
+        initialise_error_message_unit(os_to_register);
       }
       void reset_error_message_unit(void) {
         // reset the stream used for error messages (to std::cerr)
@@ -204,52 +223,37 @@ namespace nagcpp {
                                   std::string &rec,
                                   const types::f77_integer nchar = -1) {
         // read a record (line)
-        auto iter = unit_store_i.find(unit_number);
-        if (iter == unit_store_i.end()) {
-          // no stream associated with unit_number - throw exception
-          throw std::ios_base::failure("No registered istream associated with "
-                                       "input unit number " +
-                                       std::to_string(unit_number) + ".");
+        std::istream &is = istream_from_unit(unit_number);
+        if (nchar < 0) {
+          // read the whole line
+          std::getline(is, rec);
+          return rec.size();
         } else {
-          if (nchar < 0) {
-            // read the whole line
-            std::getline(*(iter->second), rec);
-            return rec.size();
-          } else {
-            // read in the specified number of characters
-            types::f77_integer anchar = 0;
-            rec = "";
-            for (types::f77_integer i = 0; i < nchar; ++i) {
-              char ch[1];
-              (iter->second)->read(ch, 1);
-              if (*ch != '\n' && *ch != '\r') {
-                rec += (*ch);
-                ++anchar;
-              } else if (*ch == '\r' && (iter->second)->peek() == '\n') {
-                // treat "\r\n" as a single character
-                --i;
-              } else {
-                // convert all line endings to a single \n
-                // do not include in the number of characters read
-                rec += '\n';
-              }
+          // read in the specified number of characters
+          types::f77_integer anchar = 0;
+          rec = "";
+          for (types::f77_integer i = 0; i < nchar; ++i) {
+            char ch[1];
+            is.read(ch, 1);
+            if (*ch != '\n' && *ch != '\r') {
+              rec += (*ch);
+              ++anchar;
+            } else if (*ch == '\r' && is.peek() == '\n') {
+              // treat "\r\n" as a single character
+              --i;
+            } else {
+              // convert all line endings to a single \n
+              // do not include in the number of characters read
+              rec += '\n';
             }
-            return anchar;
           }
+          return anchar;
         }
       }
       void print_rec(const types::f77_integer unit_number,
                      const std::string &rec) {
         // print a record (line)
-        auto iter = unit_store_o.find(unit_number);
-        if (iter == unit_store_o.end()) {
-          // no stream associated with unit_number - throw exception
-          throw std::ios_base::failure("No registered ostream associated with "
-                                       "output unit number " +
-                                       std::to_string(unit_number) + ".");
-        } else {
-          *(iter->second) << rec << std::endl;
-        }
+        ostream_from_unit(unit_number) << rec << std::endl;
       }
 
     private:
@@ -265,6 +269,19 @@ namespace nagcpp {
       void initialise_error_message_unit(void) {
         initialise_error_message_unit(std::cerr);
       }
+      template <typename MAPT>
+      static typename std::remove_pointer<typename MAPT::mapped_type>::type &
+        find_stream(types::f77_integer unit_number, MAPT &unit_store,
+                    const char *stream_type, const char *direction) {
+        auto iter = unit_store.find(unit_number);
+        if (iter == unit_store.end()) {
+          // no stream associated with unit_number - throw exception
+          throw std::ios_base::failure(
+            std::string("No registered ") + stream_type + " associated with " +
+            direction + " unit number " + std::to_string(unit_number) + ".");
+        }
+        return *(iter->second);
+      }
       void reset_standard_channels(types::f77_integer unit_number) {
         if (unit_number == adv_unit_number) {
           reset_advisory_message_unit();
@@ -381,6 +398,41 @@ namespace nagcpp {
     // the global IO manager
     std::shared_ptr<IOManagerBase> GLOBAL_IOMANAGER =
       std::make_shared<IOManager>();
+
+    // IOManager used, in the calling thread, as the default for any
+    // utility::Optional created while it is set ...
+    // (nullptr means use GLOBAL_IOMANAGER)
+    inline std::shared_ptr<IOManagerBase> &current_default_iomanager(void) {
+      static thread_local std::shared_ptr<IOManagerBase> iomanager = nullptr;
+      return iomanager;
+    }
+    inline std::shared_ptr<IOManagerBase> default_iomanager(void) {
+      const std::shared_ptr<IOManagerBase> &iomanager =
+        current_default_iomanager();
+      return iomanager ? iomanager : GLOBAL_IOMANAGER;
+    }
+
+    // set the default IOManager for the calling thread for the lifetime
+    // of this object, e.g. so that solves run from a pool of threads can
+    // each send their output to their own streams
+    //   iomanager::ScopedDefaultIOManager scope(
+    //     iomanager::IOManager::thread_local_instance());
+    class ScopedDefaultIOManager {
+    private:
+      std::shared_ptr<IOManagerBase> previous;
+
+    public:
+      explicit ScopedDefaultIOManager(
+        std::shared_ptr<IOManagerBase> iomanager)
+        : previous(current_default_iomanager()) {
+        current_default_iomanager() = iomanager;
+      }
+      ~ScopedDefaultIOManager() { current_default_iomanager() = previous; }
+      ScopedDefaultIOManager(const ScopedDefaultIOManager &) = delete;
+      ScopedDefaultIOManager &
+        operator=(const ScopedDefaultIOManager &) = delete;
+    };
+    // ... IOManager used, in the calling thread, as the default
   }
 }
 #endif
@@ -0,0 +1,229 @@
+#ifndef NAGCPP_IOMANAGER_BUFFERED_HPP
+#define NAGCPP_IOMANAGER_BUFFERED_HPP
+
+#include "nagcpp_engine_types.hpp"
+#include "nagcpp_iomanager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nagcpp {
+  namespace iomanager {
+    // IOManager that holds back the records printed to its output units and
+    // writes them out in blocks, rather than writing (and flushing) each
+    // record as it is produced. Useful when a solver is producing a large
+    // amount of output, e.g. an iteration log at a high "Print Level".
+    // Records are written out:
+    //   - when flush() is called, which the wrappers do once the engine has
+    //     returned, so the output of a solve is complete when it returns,
+    //   - when more than buffer_size characters are being held,
+    //   - when a stream is registered or deregistered,
+    //   - on destruction, and
+    //   - with FlushPolicy::Background, by a writer thread every
+    //     flush_interval (or sooner if half of buffer_size is in use).
+    // The order of the records written to each stream is preserved, but
+    // output written to the same stream directly (rather than via the
+    // IOManager) may appear out of order with respect to buffered records
+    // until flush() is called.
+    class BufferedIOManager : public IOManager {
+    public:
+      enum class FlushPolicy { Manual, Background };
+
+    private:
+      // a buffered record, text[start, end) is to be written to os
+      struct Record {
+        std::ostream *os;
+        size_t end;
+      };
+      struct Buffer {
+        std::string text;
+        std::vector<Record> records;
+      };
+
+      FlushPolicy policy;
+      size_t buffer_size;
+      std::chrono::milliseconds flush_interval;
+      // records are appended to front (under buffer_mtx), flush swaps it
+      // with back and writes back out (under write_mtx), so the engine is
+      // not held up while the records are being written
+      Buffer front;
+      Buffer back;
+      std::mutex buffer_mtx;
+      std::mutex write_mtx;
+      std::condition_variable writer_cv;
+      bool stop_writer;
+      std::thread writer;
+      // output stream for each unit number (nullptr if not looked up yet)
+      std::vector<std::ostream *> unit_cache;
+
+    public:
+      BufferedIOManager(
+        FlushPolicy policy_ = FlushPolicy::Manual,
+        const size_t buffer_size_ = 65536,
+        std::chrono::milliseconds flush_interval_ =
+          std::chrono::milliseconds(100))
+        : IOManager(), policy(policy_), buffer_size(buffer_size_),
+          flush_interval(flush_interval_), stop_writer(false),
+          unit_cache(static_cast<size_t>(max_unit_number) + 1, nullptr) {
+        front.text.reserve(buffer_size);
+        back.text.reserve(buffer_size);
+        if (policy == FlushPolicy::Background) {
+          writer = std::thread(&BufferedIOManager::run_writer, this);
+        }
+      }
+      BufferedIOManager(const BufferedIOManager &) = delete;
+      BufferedIOManager &operator=(const BufferedIOManager &) = delete;
+      ~BufferedIOManager() {
+        if (writer.joinable()) {
+          {
+            std::lock_guard<std::mutex> lock(buffer_mtx);
+            stop_writer = true;
+          }
+          writer_cv.notify_one();
+          writer.join();
+        }
+        flush();
+      }
+
+      void print_rec(const types::f77_integer unit_number,
+                     const std::string &rec) {
+        print_rec_chars(unit_number, rec.data(), rec.size());
+      }
+      void print_rec_chars(const types::f77_integer unit_number,
+                           const char *rec, const size_t length) {
+        // buffer a record (line)
+        bool full;
+        {
+          std::lock_guard<std::mutex> lock(buffer_mtx);
+          std::ostream *os = lookup_unit(unit_number);
+          front.text.append(rec, length);
+          front.text.push_back('\n');
+          front.records.push_back({os, front.text.size()});
+          full = (front.text.size() >= buffer_size);
+          if (!full && policy == FlushPolicy::Background &&
+              front.text.size() >= buffer_size / 2) {
+            writer_cv.notify_one();
+          }
+        }
+        if (full) {
+          flush();
+        }
+      }
+      void flush(void) {
+        // write out all buffered records
+        std::lock_guard<std::mutex> write_lock(write_mtx);
+        {
+          std::lock_guard<std::mutex> lock(buffer_mtx);
+          if (front.records.empty()) {
+            return;
+          }
+          std::swap(front, back);
+        }
+        write_back();
+      }
+
+      // any change to the registered streams flushes the buffer and
+      // clears the unit cache
+      types::f77_integer register_ostream(std::ostream &os_to_register) {
+        reset_unit_cache();
+        return IOManager::register_ostream(os_to_register);
+      }
+      void deregister_ostream(types::f77_integer unit_number) {
+        reset_unit_cache();
+        IOManager::deregister_ostream(unit_number);
+      }
+      void deregister_ostream(std::ostream &os_to_deregister) {
+        reset_unit_cache();
+        IOManager::deregister_ostream(os_to_deregister);
+      }
+      void deregister_istream(types::f77_integer unit_number) {
+        reset_unit_cache();
+        IOManager::deregister_istream(unit_number);
+      }
+      void deregister_istream(std::istream &is_to_deregister) {
+        reset_unit_cache();
+        IOManager::deregister_istream(is_to_deregister);
+      }
+      void register_to_advisory_message_unit(std::ostream &os_to_register) {
+        reset_unit_cache();
+        IOManager::register_to_advisory_message_unit(os_to_register);
+      }
+      void reset_advisory_message_unit(void) {
+        reset_unit_cache();
+        IOManager::reset_advisory_message_unit();
+      }
+      void register_to_error_message_unit(std::ostream &os_to_register) {
+        reset_unit_cache();
+        IOManager::register_to_error_message_unit(os_to_register);
+      }
+      void reset_error_message_unit(void) {
+        reset_unit_cache();
+        IOManager::reset_error_message_unit();
+      }
+
+    private:
+      std::ostream *lookup_unit(const types::f77_integer unit_number) {
+        // ostream_from_unit throws if unit_number has not been registered
+        if (unit_number < 0 || unit_number > max_unit_number) {
+          return &ostream_from_unit(unit_number);
+        }
+        std::ostream *&os = unit_cache[static_cast<size_t>(unit_number)];
+        if (!os) {
+          os = &ostream_from_unit(unit_number);
+        }
+        return os;
+      }
+      void reset_unit_cache(void) {
+        flush();
+        std::lock_guard<std::mutex> lock(buffer_mtx);
+        std::fill(unit_cache.begin(), unit_cache.end(), nullptr);
+      }
+      void write_back(void) {
+        // write the records in back, one block per run of records for the
+        // same stream, flushing each stream once
+        std::vector<std::ostream *> written;
+        size_t start = 0;
+        for (size_t i = 0; i < back.records.size(); ++i) {
+          std::ostream *os = back.records[i].os;
+          if (i + 1 < back.records.size() && back.records[i + 1].os == os) {
+            continue;
+          }
+          size_t end = back.records[i].end;
+          os->write(back.text.data() + start,
+                    static_cast<std::streamsize>(end - start));
+          start = end;
+          if (std::find(written.begin(), written.end(), os) ==
+              written.end()) {
+            written.push_back(os);
+          }
+        }
+        for (std::ostream *os : written) {
+          os->flush();
+        }
+        back.text.clear();
+        back.records.clear();
+      }
+      void run_writer(void) {
+        std::unique_lock<std::mutex> lock(buffer_mtx);
+        while (!stop_writer) {
+          writer_cv.wait_for(lock, flush_interval, [this] {
+            return stop_writer || front.text.size() >= buffer_size / 2;
+          });
+          if (front.records.empty()) {
+            continue;
+          }
+          lock.unlock();
+          flush();
+          lock.lock();
+        }
+      }
+    };
+  }
+}
+#endif
@@ -0,0 +1,214 @@
+#ifndef NAGCPP_UTILITY_ALLOCATOR_HPP
+#define NAGCPP_UTILITY_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace nagcpp {
+  namespace utility {
+    // interface for allocators used for the local arrays created by the
+    // wrappers (i.e. those held in data_handling::RawData and
+    // data_handling::StringRawData) ...
+    // by default these arrays are allocated using new [], an alternative
+    // allocator can be selected by setting the workspace_allocator member
+    // of the utility::Optional class passed to the wrapper
+    // (the arrays held in a utility::CopyableComm outlive the wrapper call
+    // and are always allocated using new [])
+    class WorkspaceAllocator {
+    public:
+      virtual ~WorkspaceAllocator() {}
+      virtual void *allocate(size_t nbytes, size_t alignment) = 0;
+      virtual void deallocate(void *p, size_t nbytes) = 0;
+    };
+    // ... interface for allocators used for the local arrays
+
+    // bump (arena) allocator ...
+    // memory is handed out from a list of blocks, deallocate does nothing
+    // and the memory is only made available again when the arena is reset
+    // (either via reset or rewind, or via a ScopedArenaReset object). The
+    // blocks themselves are retained, so once the arena is large enough no
+    // further heap allocations are required.
+    // When an arena is selected via utility::Optional, each wrapper rewinds
+    // it on exit (see ScopedWorkspaceAllocator), so repeated calls reuse
+    // the same memory.
+    // NB: the arena must not be reset while any arrays allocated from it
+    // are still in use
+    class ArenaAllocator : public WorkspaceAllocator {
+    public:
+      struct Marker {
+        size_t block;
+        size_t offset;
+      };
+
+    private:
+      struct Block {
+        std::unique_ptr<char[]> mem;
+        size_t size;
+      };
+      std::vector<Block> blocks;
+      size_t current;
+      size_t offset;
+      size_t block_size;
+
+    public:
+      explicit ArenaAllocator(size_t block_size_ = 65536)
+        : current(0), offset(0), block_size(std::max(block_size_,
+                                                     static_cast<size_t>(64))) {
+      }
+      ArenaAllocator(const ArenaAllocator &) = delete;
+      ArenaAllocator &operator=(const ArenaAllocator &) = delete;
+
+      void *allocate(size_t nbytes, size_t alignment) override {
+        if (alignment == 0) {
+          alignment = 1;
+        }
+        while (true) {
+          if (current < blocks.size()) {
+            std::uintptr_t base =
+              reinterpret_cast<std::uintptr_t>(blocks[current].mem.get());
+            std::uintptr_t start =
+              (base + offset + alignment - 1) / alignment * alignment;
+            size_t aligned_offset = static_cast<size_t>(start - base);
+            if (aligned_offset + nbytes <= blocks[current].size) {
+              offset = aligned_offset + nbytes;
+              return reinterpret_cast<void *>(start);
+            }
+            // not enough room in this block, try the next one
+            ++current;
+            offset = 0;
+          } else {
+            // need a new block
+            size_t this_size = std::max(block_size, nbytes + alignment);
+            blocks.push_back({std::unique_ptr<char[]>(new char[this_size]),
+                              this_size});
+            current = blocks.size() - 1;
+            offset = 0;
+            // subsequent blocks get larger
+            block_size *= 2;
+          }
+        }
+      }
+      void deallocate(void *p, size_t nbytes) override {}
+
+      // current position in the arena
+      Marker mark(void) const { return {current, offset}; }
+      // release all memory allocated since m was obtained
+      void rewind(const Marker &m) {
+        current = m.block;
+        offset = m.offset;
+      }
+      // release all memory allocated from the arena
+      void reset(void) {
+        current = 0;
+        offset = 0;
+      }
+      // total number of bytes held in the arena
+      size_t capacity(void) const {
+        size_t total = 0;
+        for (const auto &b : blocks) {
+          total += b.size;
+        }
+        return total;
+      }
+
+      // an arena for the calling thread
+      static std::shared_ptr<ArenaAllocator> thread_local_instance(void) {
+        static thread_local std::shared_ptr<ArenaAllocator> arena =
+          std::make_shared<ArenaAllocator>();
+        return arena;
+      }
+    };
+    // ... bump (arena) allocator
+
+    // rewind an arena to its current position when this object goes out
+    // of scope
+    class ScopedArenaReset {
+    private:
+      ArenaAllocator &arena;
+      ArenaAllocator::Marker marker;
+
+    public:
+      explicit ScopedArenaReset(ArenaAllocator &arena_)
+        : arena(arena_), marker(arena_.mark()) {}
+      ~ScopedArenaReset() { arena.rewind(marker); }
+      ScopedArenaReset(const ScopedArenaReset &) = delete;
+      ScopedArenaReset &operator=(const ScopedArenaReset &) = delete;
+    };
+
+    // allocator used, in the calling thread, for any local arrays ...
+    // (nullptr means use new [] and delete [])
+    inline WorkspaceAllocator *&current_workspace_allocator(void) {
+      static thread_local WorkspaceAllocator *allocator = nullptr;
+      return allocator;
+    }
+
+    // set the allocator used for local arrays for the lifetime of this
+    // object (used by the wrappers to select the allocator held in
+    // utility::Optional)
+    // if the allocator is an ArenaAllocator it is rewound to its position
+    // on construction when this object goes out of scope, releasing the
+    // local arrays of the wrapper call (which must therefore all be
+    // destroyed first)
+    class ScopedWorkspaceAllocator {
+    private:
+      WorkspaceAllocator *previous;
+      ArenaAllocator *arena;
+      ArenaAllocator::Marker marker;
+
+    public:
+      explicit ScopedWorkspaceAllocator(WorkspaceAllocator *allocator)
+        : previous(current_workspace_allocator()),
+          arena(dynamic_cast<ArenaAllocator *>(allocator)), marker{0, 0} {
+        if (arena) {
+          marker = arena->mark();
+        }
+        current_workspace_allocator() = allocator;
+      }
+      ~ScopedWorkspaceAllocator() {
+        current_workspace_allocator() = previous;
+        if (arena) {
+          arena->rewind(marker);
+        }
+      }
+      ScopedWorkspaceAllocator(const ScopedWorkspaceAllocator &) = delete;
+      ScopedWorkspaceAllocator &
+        operator=(const ScopedWorkspaceAllocator &) = delete;
+    };
+
+    // allocate an array of n elements of type T using the current
+    // allocator, the allocator used is returned in used and must be
+    // passed to deallocate_workspace
+    template <typename T>
+    inline T *allocate_workspace(size_t n, WorkspaceAllocator *&used) {
+      used = current_workspace_allocator();
+      if (used) {
+        T *p = static_cast<T *>(used->allocate(n * sizeof(T), alignof(T)));
+        for (size_t i = 0; i < n; ++i) {
+          ::new (static_cast<void *>(p + i)) T;
+        }
+        return p;
+      }
+      return new T[n];
+    }
+    template <typename T>
+    inline void deallocate_workspace(T *p, size_t n, WorkspaceAllocator *used) {
+      if (!p) {
+        return;
+      }
+      if (used) {
+        for (size_t i = 0; i < n; ++i) {
+          p[i].~T();
+        }
+        used->deallocate(static_cast<void *>(p), n * sizeof(T));
+      } else {
+        delete[] p;
+      }
+    }
+    // ... allocator used, in the calling thread, for any local arrays
+  }
+}
+#endif
@@ -2,6 +2,8 @@
 #define NAGCPP_UTILITY_ARRAY_HPP
 #include "nagcpp_data_handling_base.hpp"
 #include "nagcpp_engine_types.hpp"
+#include <cstddef>
+#include <type_traits>
 
 namespace nagcpp {
   namespace utility {
@@ -73,6 +75,15 @@ namespace nagcpp {
           astride1 = static_cast<types::f77_integer>(size2_);
         }
       }
+      // array2D referencing a block of a larger matrix, stride_ is the
+      // leading dimension of the larger matrix
+      template <typename IT1, typename IT2, typename IT3>
+      array2D(CRT *raw_data_, const IT1 size1_, const IT2 size2_,
+              const bool col_major_, const IT3 stride_)
+        : raw_data(raw_data_), asize1(static_cast<types::f77_integer>(size1_)),
+          asize2(static_cast<types::f77_integer>(size2_)),
+          col_major(col_major_),
+          astride1(static_cast<types::f77_integer>(stride_)) {}
 
       // disable the copy constructor and operator as we are
       // using raw pointers and have not implemented them
@@ -184,6 +195,76 @@ namespace nagcpp {
       }
     };
 
+    // non-owning, contiguous, one-dimensional view onto an existing block
+    // of memory ...
+    // mirrors the parts of the std::span interface used in callbacks, so
+    // a callback argument declared as a vector_view is handed the address
+    // of the engine array directly (i.e. no allocation or copying takes
+    // place, irrespective of the length of the array)
+    // use vector_view<const RT> for input arguments and vector_view<RT>
+    // for output or input / output arguments
+    template <typename T>
+    class vector_view {
+    public:
+      typedef T element_type;
+      typedef typename std::remove_cv<T>::type value_type;
+      typedef std::size_t size_type;
+      typedef T *pointer;
+      typedef T &reference;
+      typedef T *iterator;
+
+    private:
+      T *raw_data;
+      std::size_t asize1;
+
+    public:
+      vector_view() : raw_data(nullptr), asize1(0) {}
+      template <typename IT>
+      vector_view(T *raw_data_, const IT size_)
+        : raw_data(raw_data_), asize1(static_cast<std::size_t>(size_)) {}
+      // view onto any contiguous container with data() and size() methods
+      template <typename AC,
+                typename = typename std::enable_if<
+                  !std::is_same<typename std::remove_cv<AC>::type,
+                                vector_view>::value>::type>
+      vector_view(AC &array_container)
+        : raw_data(array_container.data()),
+          asize1(static_cast<std::size_t>(array_container.size())) {}
+      // allow vector_view<RT> to be used where vector_view<const RT> is
+      // expected
+      template <typename U,
+                typename = typename std::enable_if<
+                  std::is_same<const U, T>::value>::type>
+      vector_view(const vector_view<U> &other)
+        : raw_data(other.data()), asize1(other.size()) {}
+
+      T *data(void) const { return raw_data; }
+      std::size_t size(void) const { return asize1; }
+      bool empty(void) const { return (asize1 == 0); }
+
+      // methods used by the data handling layer when a vector_view is
+      // supplied as an argument to a wrapper
+      types::f77_integer size1(void) const {
+        return static_cast<types::f77_integer>(asize1);
+      }
+      types::f77_integer ndims(void) const { return 1; }
+
+      iterator begin(void) const { return raw_data; }
+      iterator end(void) const { return raw_data + asize1; }
+      T &front(void) const { return raw_data[0]; }
+      T &back(void) const { return raw_data[asize1 - 1]; }
+
+      template <typename IT>
+      T &operator()(const IT i) const {
+        return raw_data[i];
+      }
+      template <typename IT>
+      T &operator[](const IT i) const {
+        return raw_data[i];
+      }
+    };
+    // ... non-owning, contiguous, one-dimensional view
+
   }
 }
 #endif
@@ -3,6 +3,9 @@
 
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
+#include <cstring>
+#include <memory>
+#include <mutex>
 
 namespace nagcpp {
   namespace utility {
@@ -12,14 +15,27 @@ namespace nagcpp {
     public:
       void *handle;
       bool initialized;
+      // true if handle was initialized via a different object (for example,
+      // the comm passed to a monitoring function), in which case options
+      // can be queried and set via this object, but it cannot be passed to
+      // any other routine
+      bool borrowed;
 
     public:
-      NoneCopyableComm() : handle(nullptr), initialized(false) {}
+      NoneCopyableComm()
+        : handle(nullptr), initialized(false), borrowed(false) {}
       virtual ~NoneCopyableComm() {}
-      NoneCopyableComm(void *handle_) : handle(handle_), initialized(false) {}
+      NoneCopyableComm(void *handle_)
+        : handle(handle_), initialized(false), borrowed(false) {}
       NoneCopyableComm(const NoneCopyableComm &) = delete;
       NoneCopyableComm &operator=(const NoneCopyableComm &) = delete;
       bool check(void) const { return initialized; }
+      // check used by the routines that only query or set options
+      bool check_options(void) const { return initialized || borrowed; }
+      // called whenever an option held in the handle may have changed
+      virtual void options_changed(void) {}
+      // called whenever the handle has been initialized or freed
+      virtual void handle_changed(void) {}
     };
 
     class CopyableComm {
@@ -47,7 +63,18 @@ namespace nagcpp {
 
       bool initialized;
 
+    private:
+      // if not null, owner holds the communication arrays and they are
+      // shared with one or more snapshots (see snapshot)
+      mutable std::shared_ptr<CopyableComm> owner;
+      // guards the creation of owner, so that snapshots of the same object
+      // can be taken concurrently
+      mutable std::mutex share_mtx;
+
     public:
+      // tag used to select the snapshot constructor
+      struct snapshot_tag {};
+
       CopyableComm()
         : handle(nullptr), rcomm(nullptr), lrcomm(0), icomm(nullptr), licomm(0),
           ccomm(nullptr), lccomm(0), ccomm_length(0), lcomm(nullptr), llcomm(0),
@@ -58,45 +85,89 @@ namespace nagcpp {
         copyfrom(from);
       }
       CopyableComm &operator=(const CopyableComm &from) {
-        copyfrom(from);
+        if (this != &from) {
+          copyfrom(from);
+        }
         return *this;
       }
+      // moving transfers ownership of the communication arrays, from is
+      // left empty
+      CopyableComm(CopyableComm &&from) noexcept : CopyableComm() {
+        steal(from);
+      }
+      CopyableComm &operator=(CopyableComm &&from) noexcept {
+        if (this != &from) {
+          deallocate();
+          steal(from);
+        }
+        return *this;
+      }
+      // copy-on-write copy of from ...
+      // the communication arrays are shared between from and the new
+      // object, no data is copied. Either object can be used as normal,
+      // the wrappers call ensure_unique before the arrays are modified,
+      // so a deep copy only takes place if a routine that updates the
+      // arrays is called while they are still shared
+      // several snapshots of from can be taken concurrently, but not while
+      // from itself is being modified
+      CopyableComm(const CopyableComm &from, snapshot_tag) : CopyableComm() {
+        std::lock_guard<std::mutex> lock(from.share_mtx);
+        from.share();
+        alias(from);
+        owner = from.owner;
+      }
+      CopyableComm snapshot(void) const {
+        return CopyableComm(*this, snapshot_tag());
+      }
+      // ... copy-on-write copy of from
+      // true if the communication arrays are shared with a snapshot
+      bool is_shared(void) const { return owner && owner.use_count() > 1; }
+      // take a private copy of the communication arrays if they are
+      // currently shared with a snapshot
+      void ensure_unique(void) {
+        if (owner) {
+          if (owner.use_count() > 1) {
+            CopyableComm tmp(*this);
+            // (the copy does not include the handle)
+            tmp.handle = handle;
+            deallocate();
+            steal(tmp);
+          } else {
+            // this is the only user, take back ownership of the arrays
+            std::shared_ptr<CopyableComm> last = std::move(owner);
+            last->release();
+          }
+        }
+      }
       void deallocate() {
-        if (rcomm) {
-          delete[] rcomm;
-          rcomm = nullptr;
+        if (owner) {
+          // the arrays are owned by (and freed via) owner
+          owner.reset();
+          release();
+          initialized = false;
+          return;
         }
+        delete[] rcomm;
+        rcomm = nullptr;
         lrcomm = 0;
-        if (icomm) {
-          delete[] icomm;
-          icomm = nullptr;
-        }
+        delete[] icomm;
+        icomm = nullptr;
         licomm = 0;
-        if (ccomm) {
-          delete[] ccomm;
-          ccomm = nullptr;
-        }
+        delete[] ccomm;
+        ccomm = nullptr;
         lccomm = 0;
         ccomm_length = 0;
-        if (lcomm) {
-          delete[] lcomm;
-          lcomm = nullptr;
-        }
+        delete[] lcomm;
+        lcomm = nullptr;
         llcomm = 0;
-        if (zcomm) {
-          delete[] zcomm;
-          zcomm = nullptr;
-        }
+        delete[] zcomm;
+        zcomm = nullptr;
         lzcomm = 0;
-        if (rcomm2) {
-          delete[] rcomm2;
-          rcomm2 = nullptr;
-        }
-        licomm2 = 0;
-        if (icomm2) {
-          delete[] icomm2;
-          rcomm2 = nullptr;
-        }
+        delete[] rcomm2;
+        rcomm2 = nullptr;
+        lrcomm2 = 0;
+        delete[] icomm2;
+        icomm2 = nullptr;
         licomm2 = 0;
 
         initialized = false;
@@ -131,6 +202,10 @@ namespace nagcpp {
         lrcomm2 = lrcomm2_;
         licomm2 = licomm2_;
 
+        // the communication arrays outlive the wrapper call, so they are
+        // always allocated with new [] rather than taken from the current
+        // workspace allocator (which may be an arena that is reset between
+        // calls)
         if (lrcomm > 0) {
           rcomm = new double[lrcomm];
         }
@@ -174,27 +249,78 @@ namespace nagcpp {
         deallocate();
         allocate(comm.lrcomm, comm.licomm, comm.lccomm, comm.llcomm,
                  comm.lzcomm, comm.lrcomm2, comm.licomm2);
-        for (types::f77_integer i = 0; i < lrcomm; i++) {
-          rcomm[i] = comm.rcomm[i];
-        }
-        for (types::f77_integer i = 0; i < licomm; i++) {
-          icomm[i] = comm.icomm[i];
-        }
-        for (types::f77_integer i = 0; i < lccomm; i++) {
-          ccomm[i] = comm.ccomm[i];
-        }
+        copy_array(rcomm, comm.rcomm, lrcomm);
+        copy_array(icomm, comm.icomm, licomm);
+        copy_array(ccomm, comm.ccomm, lccomm);
         ccomm_length = comm.ccomm_length;
-        for (types::f77_integer i = 0; i < llcomm; i++) {
-          lcomm[i] = comm.lcomm[i];
-        }
-        for (types::f77_integer i = 0; i < 2 * lzcomm; i++) {
-          zcomm[i] = comm.zcomm[i];
-        }
-        for (types::f77_integer i = 0; i < lrcomm2; i++) {
-          rcomm2[i] = comm.rcomm2[i];
+        copy_array(lcomm, comm.lcomm, llcomm);
+        copy_array(zcomm, comm.zcomm, 2 * lzcomm);
+        copy_array(rcomm2, comm.rcomm2, lrcomm2);
+        copy_array(icomm2, comm.icomm2, licomm2);
+        srcomm = comm.srcomm;
+        initialized = comm.initialized;
+      }
+      template <typename T>
+      static void copy_array(T *to, const T *from, types::f77_integer n) {
+        if (n > 0) {
+          std::memcpy(to, from, static_cast<size_t>(n) * sizeof(T));
         }
-        for (types::f77_integer i = 0; i < licomm2; i++) {
-          icomm2[i] = comm.icomm2[i];
+      }
+      // point this object at the arrays held in comm (without taking
+      // ownership of them)
+      void alias(const CopyableComm &comm) {
+        rcomm = comm.rcomm;
+        lrcomm = comm.lrcomm;
+        icomm = comm.icomm;
+        licomm = comm.licomm;
+        ccomm = comm.ccomm;
+        lccomm = comm.lccomm;
+        ccomm_length = comm.ccomm_length;
+        lcomm = comm.lcomm;
+        llcomm = comm.llcomm;
+        zcomm = comm.zcomm;
+        lzcomm = comm.lzcomm;
+        rcomm2 = comm.rcomm2;
+        lrcomm2 = comm.lrcomm2;
+        icomm2 = comm.icomm2;
+        licomm2 = comm.licomm2;
+        srcomm = comm.srcomm;
+        initialized = comm.initialized;
+      }
+      // forget the arrays without freeing them
+      void release(void) {
+        rcomm = nullptr;
+        lrcomm = 0;
+        icomm = nullptr;
+        licomm = 0;
+        ccomm = nullptr;
+        lccomm = 0;
+        ccomm_length = 0;
+        lcomm = nullptr;
+        llcomm = 0;
+        zcomm = nullptr;
+        lzcomm = 0;
+        rcomm2 = nullptr;
+        lrcomm2 = 0;
+        icomm2 = nullptr;
+        licomm2 = 0;
+      }
+      // take ownership of the arrays held in from, from is left empty
+      void steal(CopyableComm &from) {
+        alias(from);
+        handle = from.handle;
+        owner = std::move(from.owner);
+        from.handle = nullptr;
+        from.release();
+        from.owner.reset();
+        from.srcomm = 0;
+        from.initialized = false;
+      }
+      // hand ownership of the arrays to owner, so that they can be shared
+      void share(void) const {
+        if (!owner) {
+          owner = std::make_shared<CopyableComm>();
+          owner->alias(*this);
         }
       }
     };
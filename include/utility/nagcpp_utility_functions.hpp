@@ -3,8 +3,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 namespace nagcpp {
   namespace utility {
@@ -40,12 +46,51 @@ namespace nagcpp {
     bool rname_eq(const std::string &rname1, const std::string &rname2) {
       return streq(strip_namespace(rname1), strip_namespace(rname2));
     }
+    // shortest representation of value (using at most 17 significant
+    // figures) that reads back as the same value
+    // (the decimal point is always a '.', whatever the C locale is set to)
+    inline std::string real_to_string(const double value) {
+#if defined(__cpp_lib_to_chars)
+      char buffer[32];
+      std::to_chars_result res =
+        std::to_chars(buffer, buffer + sizeof(buffer), value,
+                      std::chars_format::general);
+      return std::string(buffer, res.ptr);
+#else
+      char buffer[32];
+      for (int precision = 15; precision <= 17; ++precision) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if (std::strtod(buffer, nullptr) == value) {
+          break;
+        }
+      }
+      // snprintf uses the decimal point of the C locale
+      std::string str(buffer);
+      const char *point = std::localeconv()->decimal_point;
+      if (point && *point && std::strcmp(point, ".") != 0) {
+        std::size_t pos = str.find(point);
+        if (pos != std::string::npos) {
+          str.replace(pos, std::strlen(point), ".");
+        }
+      }
+      return str;
+#endif
+    }
     std::string set_optstr(const std::string &opt) { return opt; }
     template <typename T>
     std::string set_optstr(const std::string &opt, const T value) {
-      std::ostringstream strs;
-      strs << opt << " = " << value;
-      return strs.str();
+      if constexpr (std::is_floating_point<T>::value) {
+        return opt + " = " + real_to_string(static_cast<double>(value));
+      } else if constexpr (std::is_integral<T>::value &&
+                           !std::is_same<T, bool>::value) {
+        return opt + " = " + std::to_string(value);
+      } else if constexpr (std::is_convertible<T, std::string>::value) {
+        return opt + " = " + std::string(value);
+      } else {
+        std::ostringstream strs;
+        strs << opt << " = " << value;
+        return strs.str();
+      }
     }
 
     // return true if a callback has been supplied, false otherwise
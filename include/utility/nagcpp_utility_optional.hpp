@@ -3,6 +3,9 @@
 
 #include "nagcpp_error_handler.hpp"
 #include "nagcpp_iomanager.hpp"
+#include "nagcpp_utility_allocator.hpp"
+#include "nagcpp_utility_profiler.hpp"
+#include <memory>
 
 namespace nagcpp {
   namespace utility {
@@ -12,9 +15,17 @@ namespace nagcpp {
       error_handler::ErrorHandler fail;
       std::shared_ptr<iomanager::IOManagerBase> iomanager;
       bool default_to_col_major;
+      // allocator used for any local arrays created by the wrapper
+      // (nullptr means use new [], an ArenaAllocator is rewound when the
+      // wrapper returns)
+      std::shared_ptr<WorkspaceAllocator> workspace_allocator;
+      // records the time spent in any callbacks during the call
+      // (nullptr means no profiling)
+      std::shared_ptr<CallbackProfiler> callback_profiler;
       Optional()
         : fail(error_handler::GLOBAL_ERROR_HANDLER_CONTROL),
-          iomanager(iomanager::GLOBAL_IOMANAGER), default_to_col_major(true) {}
+          iomanager(iomanager::default_iomanager()), default_to_col_major(true),
+          workspace_allocator(nullptr), callback_profiler(nullptr) {}
       virtual ~Optional() {}
     };
   }
@@ -0,0 +1,74 @@
+#ifndef NAGCPP_UTILITY_OPTIONS_HPP
+#define NAGCPP_UTILITY_OPTIONS_HPP
+
+#include "utility/nagcpp_engine_types.hpp"
+#include "utility/nagcpp_utility_functions.hpp"
+#include <string>
+#include <type_traits>
+
+namespace nagcpp {
+  namespace utility {
+    // value type for options that do not take a value (for example,
+    // "Defaults")
+    struct OptionKeyword {};
+
+    // compile time description of an optional parameter ...
+    // COMM is the communication class the option can be applied to and T
+    // the type of its value (types::f77_integer, double, std::string or
+    // OptionKeyword). Options are applied by passing the descriptor to the
+    // set or set_options method of COMM, so a misspelt option name, an
+    // option from a different suite or a value of the wrong type is a
+    // compile time error
+    template <typename COMM, typename T>
+    struct OptionDescriptor {
+      const char *name;
+    };
+
+    // check that a value of type V can be supplied for an option of type T
+    template <typename T, typename V>
+    struct is_valid_option_value {
+      using DV = typename std::decay<V>::type;
+      static constexpr bool value =
+        (std::is_same<T, double>::value && std::is_arithmetic<DV>::value &&
+         !std::is_same<DV, bool>::value) ||
+        (std::is_same<T, types::f77_integer>::value &&
+         std::is_integral<DV>::value && !std::is_same<DV, bool>::value) ||
+        (std::is_same<T, std::string>::value &&
+         std::is_convertible<DV, std::string>::value);
+    };
+
+    // option string for a descriptor and value
+    template <typename COMM, typename T, typename V>
+    inline std::string set_optstr(const OptionDescriptor<COMM, T> &option,
+                                  const V &value) {
+      static_assert(is_valid_option_value<T, V>::value,
+                    "Invalid type for the value of this option");
+      return set_optstr(option.name, static_cast<T>(value));
+    }
+    template <typename COMM>
+    inline std::string
+      set_optstr(const OptionDescriptor<COMM, OptionKeyword> &option) {
+      return option.name;
+    }
+    // ... compile time description of an optional parameter
+
+    // a single option setting, used to pass a list of settings to the
+    // set_options method of COMM, e.g.
+    // comm.set_options({{options::PrintLevel, 0},
+    //                   {options::StopTolerance, 1.0e-8}});
+    template <typename COMM>
+    class OptionSetting {
+    private:
+      std::string optstr;
+
+    public:
+      template <typename T, typename V>
+      OptionSetting(const OptionDescriptor<COMM, T> &option, const V &value)
+        : optstr(set_optstr(option, value)) {}
+      OptionSetting(const OptionDescriptor<COMM, OptionKeyword> &option)
+        : optstr(set_optstr(option)) {}
+      const std::string &str(void) const { return optstr; }
+    };
+  }
+}
+#endif
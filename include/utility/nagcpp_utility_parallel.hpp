@@ -0,0 +1,211 @@
+#ifndef NAGCPP_UTILITY_PARALLEL_HPP
+#define NAGCPP_UTILITY_PARALLEL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nagcpp {
+  namespace utility {
+    // number of threads to use if nthreads <= 0 was requested
+    inline size_t thread_count(int nthreads) {
+      if (nthreads > 0) {
+        return static_cast<size_t>(nthreads);
+      }
+      size_t nhw = static_cast<size_t>(std::thread::hardware_concurrency());
+      return (nhw > 0) ? nhw : 1;
+    }
+
+    // split the range [0, n) into (at most) nthreads contiguous chunks and
+    // call fn(begin, end, ichunk) for each chunk ...
+    // the first chunk is processed on the calling thread, the remainder on
+    // additional std::threads (or on the calling thread, if no more threads
+    // can be started). If fn throws, the first exception (in chunk
+    // order) is rethrown once all threads have finished.
+    // returns the number of chunks used
+    template <typename FN>
+    inline size_t parallel_for(size_t n, int nthreads, FN &&fn) {
+      if (n == 0) {
+        return 0;
+      }
+      size_t nchunks = std::min(thread_count(nthreads), n);
+      if (nchunks == 1) {
+        fn(static_cast<size_t>(0), n, static_cast<size_t>(0));
+        return 1;
+      }
+
+      std::vector<std::exception_ptr> eptrs(nchunks);
+      auto run_chunk = [&](size_t ichunk) {
+        size_t begin = (n * ichunk) / nchunks;
+        size_t end = (n * (ichunk + 1)) / nchunks;
+        try {
+          fn(begin, end, ichunk);
+        } catch (...) {
+          eptrs[ichunk] = std::current_exception();
+        }
+      };
+
+      // if a thread cannot be started (std::system_error), the chunks that
+      // have not been given a thread are run on the calling thread, so that
+      // every started thread is still joined
+      std::vector<std::thread> threads;
+      size_t nstarted = 1;
+      try {
+        threads.reserve(nchunks - 1);
+        for (; nstarted < nchunks; ++nstarted) {
+          threads.emplace_back(run_chunk, nstarted);
+        }
+      } catch (...) {
+      }
+      run_chunk(0);
+      for (size_t ichunk = nstarted; ichunk < nchunks; ++ichunk) {
+        run_chunk(ichunk);
+      }
+      for (auto &th : threads) {
+        th.join();
+      }
+
+      for (const auto &eptr : eptrs) {
+        if (eptr) {
+          std::rethrow_exception(eptr);
+        }
+      }
+      return nchunks;
+    }
+    // ... split the range [0, n) into (at most) nthreads contiguous chunks
+
+    // a fixed set of worker threads that are reused between calls ...
+    // ThreadPool::parallel_for behaves as utility::parallel_for, but the
+    // nthreads-1 additional threads are started on first use and then
+    // kept until the pool is destroyed, so that repeated calls (for
+    // example, once per iteration of a solver) do not pay for starting and
+    // joining threads each time.
+    // Only one call can use the workers at a time, a call made while the
+    // pool is busy (from another thread, or from within fn) falls back to
+    // utility::parallel_for
+    class ThreadPool {
+    private:
+      size_t nthreads;
+      std::vector<std::thread> workers;
+      // held for the duration of parallel_for
+      std::mutex busy;
+      // guards the remaining members
+      std::mutex mtx;
+      std::condition_variable cv_start;
+      std::condition_variable cv_done;
+      std::function<void(size_t)> task;
+      size_t ntasks;
+      size_t npending;
+      size_t generation;
+      bool stop;
+
+      // (seen is the generation when the worker was started)
+      void worker(size_t iworker, size_t seen) {
+        while (true) {
+          size_t local_ntasks;
+          {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv_start.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+              return;
+            }
+            seen = generation;
+            local_ntasks = ntasks;
+          }
+          // worker i runs chunk i+1, chunk 0 is run by the caller
+          if (iworker + 1 < local_ntasks) {
+            task(iworker + 1);
+          }
+          std::lock_guard<std::mutex> lock(mtx);
+          if (--npending == 0) {
+            cv_done.notify_one();
+          }
+        }
+      }
+      // start any workers that are not yet running, as many as possible
+      void start_workers(void) {
+        try {
+          workers.reserve(nthreads - 1);
+          while (workers.size() < nthreads - 1) {
+            workers.emplace_back(&ThreadPool::worker, this, workers.size(),
+                                 generation);
+          }
+        } catch (...) {
+        }
+      }
+
+    public:
+      explicit ThreadPool(int nthreads_)
+        : nthreads(thread_count(nthreads_)), ntasks(0), npending(0),
+          generation(0), stop(false) {}
+      ~ThreadPool() {
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          stop = true;
+        }
+        cv_start.notify_all();
+        for (auto &th : workers) {
+          th.join();
+        }
+      }
+      ThreadPool(const ThreadPool &) = delete;
+      ThreadPool &operator=(const ThreadPool &) = delete;
+
+      // the number of threads (including the calling thread) used
+      size_t size(void) const { return nthreads; }
+
+      // as utility::parallel_for(n, size(), fn)
+      template <typename FN>
+      size_t parallel_for(size_t n, FN &&fn) {
+        if (n == 0) {
+          return 0;
+        }
+        std::unique_lock<std::mutex> busy_lock(busy, std::try_to_lock);
+        if (!busy_lock || std::min(nthreads, n) == 1) {
+          return utility::parallel_for(n, static_cast<int>(nthreads), fn);
+        }
+        start_workers();
+        size_t nchunks = std::min(workers.size() + 1, n);
+
+        std::vector<std::exception_ptr> eptrs(nchunks);
+        auto run_chunk = [&](size_t ichunk) {
+          size_t begin = (n * ichunk) / nchunks;
+          size_t end = (n * (ichunk + 1)) / nchunks;
+          try {
+            fn(begin, end, ichunk);
+          } catch (...) {
+            eptrs[ichunk] = std::current_exception();
+          }
+        };
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          task = run_chunk;
+          ntasks = nchunks;
+          npending = workers.size();
+          ++generation;
+        }
+        cv_start.notify_all();
+        run_chunk(0);
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          cv_done.wait(lock, [&] { return npending == 0; });
+          task = nullptr;
+        }
+
+        for (const auto &eptr : eptrs) {
+          if (eptr) {
+            std::rethrow_exception(eptr);
+          }
+        }
+        return nchunks;
+      }
+    };
+    // ... a fixed set of worker threads that are reused between calls
+  }
+}
+#endif
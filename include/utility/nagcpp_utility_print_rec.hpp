@@ -25,12 +25,12 @@ namespace nagcpp {
                  types::f77_integer &ierr NAG_NSTDCALL_LEN(length_rec)) {
       error_handler::ExceptionPointer *ep =
         static_cast<error_handler::ExceptionPointer *>(en_data.wrapptr1);
-      std::string this_line(rec, length_rec);
       std::shared_ptr<iomanager::IOManagerBase> *iomanager =
         static_cast<std::shared_ptr<iomanager::IOManagerBase> *>(print_rec);
       ierr = 0;
       try {
-        (*iomanager)->print_rec(nout, this_line);
+        (*iomanager)->print_rec_chars(nout, rec,
+                                     static_cast<size_t>(length_rec));
       } catch (...) {
         // callback threw an exception
         en_data.hlperr = error_handler::HLPERR_PRINT_REC_EXCEPTION;
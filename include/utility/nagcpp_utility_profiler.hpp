@@ -0,0 +1,153 @@
+#ifndef NAGCPP_UTILITY_PROFILER_HPP
+#define NAGCPP_UTILITY_PROFILER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nagcpp {
+  namespace utility {
+    // call count and wall clock times (in seconds) for a single callback
+    struct CallbackTiming {
+      std::string name;
+      size_t ncalls;
+      double total_time;
+      double min_time;
+      double max_time;
+      CallbackTiming(const std::string &name_)
+        : name(name_), ncalls(0), total_time(0.0), min_time(0.0),
+          max_time(0.0) {}
+    };
+
+    // timings from a single call to a wrapper
+    struct CallbackProfile {
+      // wall clock time spent in the engine call, including the callbacks
+      double total_time;
+      // total_time less the time spent in the callbacks
+      double engine_time;
+      // one entry per callback argument of the wrapper, in the order they
+      // appear in the argument list
+      std::vector<CallbackTiming> callbacks;
+      CallbackProfile() : total_time(0.0), engine_time(0.0) {}
+      // timing for the named callback (nullptr if there isn't one)
+      const CallbackTiming *get(const std::string &name) const {
+        for (const auto &timing : callbacks) {
+          if (timing.name == name) {
+            return &timing;
+          }
+        }
+        return nullptr;
+      }
+    };
+
+    // records the time spent in each callback of a wrapper ...
+    // profiling is enabled by attaching a profiler to the optional parameter
+    // container of the wrapper, e.g.
+    //   opt.callback_profiler = std::make_shared<utility::CallbackProfiler>();
+    //   opt::handle_solve_ipopt(..., opt);
+    //   const utility::CallbackProfile &profile =
+    //     opt.callback_profiler->get_profile();
+    // the profile is reset at the start of each call. The timings are
+    // taken around the call to the users function, including the
+    // conversion of its arguments. Calls may be recorded from more than
+    // one thread, but a profiler should only be attached to one wrapper
+    // call at a time
+    class CallbackProfiler {
+    private:
+      typedef std::chrono::steady_clock clock;
+      CallbackProfile profile;
+      clock::time_point solve_start;
+      std::mutex record_mtx;
+
+      static double elapsed(clock::time_point start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+      }
+
+    public:
+      CallbackProfiler() {}
+      const CallbackProfile &get_profile(void) const { return profile; }
+
+      void start(std::initializer_list<const char *> names) {
+        profile = CallbackProfile();
+        for (const char *name : names) {
+          profile.callbacks.push_back(CallbackTiming(name));
+        }
+        solve_start = clock::now();
+      }
+      void stop(void) {
+        profile.total_time = elapsed(solve_start);
+        double callback_time = 0.0;
+        for (const auto &timing : profile.callbacks) {
+          callback_time += timing.total_time;
+        }
+        profile.engine_time = std::max(0.0, profile.total_time - callback_time);
+      }
+      void record(size_t i, double t) {
+        std::lock_guard<std::mutex> lock(record_mtx);
+        CallbackTiming &timing = profile.callbacks[i];
+        if (timing.ncalls == 0) {
+          timing.min_time = timing.max_time = t;
+        } else {
+          timing.min_time = std::min(timing.min_time, t);
+          timing.max_time = std::max(timing.max_time, t);
+        }
+        ++timing.ncalls;
+        timing.total_time += t;
+      }
+
+      // times a call to a wrapper, used around the engine call
+      class SolveTimer {
+      private:
+        CallbackProfiler *profiler;
+
+      public:
+        SolveTimer(CallbackProfiler *profiler_,
+                   std::initializer_list<const char *> names)
+          : profiler(profiler_) {
+          if (profiler) {
+            profiler->start(names);
+          }
+        }
+        SolveTimer(const SolveTimer &) = delete;
+        SolveTimer &operator=(const SolveTimer &) = delete;
+        void stop(void) {
+          if (profiler) {
+            profiler->stop();
+            profiler = nullptr;
+          }
+        }
+        ~SolveTimer() { stop(); }
+      };
+
+      // times a single call to callback i, used in the callback helpers
+      class CallTimer {
+      private:
+        CallbackProfiler *profiler;
+        size_t i;
+        clock::time_point start;
+
+      public:
+        CallTimer(CallbackProfiler *profiler_, size_t i_)
+          : profiler(profiler_), i(i_) {
+          if (profiler) {
+            start = clock::now();
+          }
+        }
+        CallTimer(const CallTimer &) = delete;
+        CallTimer &operator=(const CallTimer &) = delete;
+        ~CallTimer() {
+          if (profiler) {
+            profiler->record(i, elapsed(start));
+          }
+        }
+      };
+    };
+    // ... records the time spent in each callback of a wrapper
+  }
+}
+#endif
@@ -0,0 +1,81 @@
+// micro-benchmark for error_handler::ErrorHandler::prepare
+// (not a unit test, so not run by run_unit_tests.sh)
+//
+// reports the time per call of prepare, as called on entry to each wrapper,
+// against a copy of the original implementation which always reconstructed
+// the function name and cleared all of the error state
+#include "utility/nagcpp_error_handler.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+using namespace nagcpp;
+
+namespace {
+  // original implementation of ErrorHandler::prepare
+  void legacy_prepare(error_handler::ErrorHandler &eh,
+                      std::string fun_name_ = "") {
+    eh.fun_name = fun_name_;
+    eh.ierr = 0;
+    eh.ifmt = 0;
+    eh.msg = "";
+    eh.type = error_handler::ErrorType::NoError;
+    eh.category = error_handler::ErrorCategory::None;
+    eh.errorid = error_handler::IERR_SUCCESS;
+    eh.eb_data.clear();
+    std::memset(eh.errbuf, '\0', 201 * sizeof(char));
+    eh.contact_nag = false;
+    eh.error_thrown = false;
+    eh.warning_thrown = false;
+  }
+
+  // time niter calls of fn, returning the average time per call in ns
+  template <typename FN>
+  double time_per_call(size_t niter, FN &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < niter; ++i) {
+      fn(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           static_cast<double>(niter);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  size_t niter =
+    (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 10000000;
+  // every nfail calls is assumed to have failed
+  size_t nfail = 100;
+
+  error_handler::ErrorHandler eh;
+  volatile char sink = 0;
+
+  double t_legacy = time_per_call(niter, [&](size_t i) {
+    legacy_prepare(eh, "fit::dim1_spline_eval (e02bb)");
+    if (i % nfail == 0) {
+      eh.errorid = 1;
+      eh.errbuf[0] = '1';
+    }
+    sink = sink + eh.errbuf[0];
+  });
+  double t_new = time_per_call(niter, [&](size_t i) {
+    eh.prepare("fit::dim1_spline_eval (e02bb)");
+    if (i % nfail == 0) {
+      eh.errorid = 1;
+      eh.errbuf[0] = '1';
+    }
+    sink = sink + eh.errbuf[0];
+  });
+
+  std::cout << "ErrorHandler::prepare, " << niter << " calls, 1 in " << nfail
+            << " failing" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  original : " << std::setw(8) << t_legacy << " ns per call"
+            << std::endl;
+  std::cout << "  current  : " << std::setw(8) << t_new << " ns per call"
+            << std::endl;
+  return 0;
+}
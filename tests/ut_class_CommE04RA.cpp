@@ -0,0 +1,120 @@
+// unit test for the option handling in opt::CommE04RA
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "e04/nagcpp_e04mt.hpp"
+#include "e04/nagcpp_e04re.hpp"
+#include "e04/nagcpp_e04rh.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_option_cache : public TestCase {
+  void run() override {
+    opt::CommE04RA handle(2);
+    {
+      SUB_TEST("default values");
+      ASSERT_EQUAL(handle.get_PrintLevel(), 2);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 2);
+    }
+    {
+      SUB_TEST("named setters");
+      handle.PrintLevel(1);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 1);
+      handle.LPIPMStopTolerance(1.0e-9);
+      ASSERT_FLOATS_EQUAL(handle.get_LPIPMStopTolerance(), 1.0e-9);
+    }
+    {
+      SUB_TEST("option strings");
+      handle.set("Print Level = 3");
+      ASSERT_EQUAL(handle.get_PrintLevel(), 3);
+      opt::handle_opt_set(handle, "Print Level = 4");
+      ASSERT_EQUAL(handle.get_PrintLevel(), 4);
+    }
+    {
+      SUB_TEST("set_options");
+      handle.set_options({"Print Level = 0", "LP IPM Stop Tolerance = 1.0e-7",
+                          "Print Solution = YES"});
+      ASSERT_EQUAL(handle.get_PrintLevel(), 0);
+      ASSERT_FLOATS_EQUAL(handle.get_LPIPMStopTolerance(), 1.0e-7);
+      ASSERT_STRINGS_EQUAL(handle.get_PrintSolution(), "YES");
+      ASSERT_THROWS(error_handler::ErrorException,
+                    handle.set_options({"Print Level = 1", "Not An Option",
+                                        "Print Level = 2"}));
+      ASSERT_EQUAL(handle.get_PrintLevel(), 1);
+    }
+    {
+      SUB_TEST("option descriptors");
+      namespace zm = opt::e04zm_options;
+      handle.set(zm::PrintLevel, 1).set(zm::LPIPMStopTolerance, 1.0e-8);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 1);
+      ASSERT_FLOATS_EQUAL(handle.get_LPIPMStopTolerance(), 1.0e-8);
+      handle.set_options({{zm::PrintLevel, 0}, {zm::PrintSolution, "YES"}});
+      ASSERT_EQUAL(handle.get_PrintLevel(), 0);
+      ASSERT_STRINGS_EQUAL(handle.get_PrintSolution(), "YES");
+      handle.set(zm::Defaults);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 2);
+    }
+    {
+      SUB_TEST("defaults");
+      handle.Defaults();
+      ASSERT_EQUAL(handle.get_PrintLevel(), 2);
+      ASSERT_STRINGS_EQUAL(handle.get_PrintSolution(), "NO");
+    }
+    {
+      SUB_TEST("handle freed and re-initialized");
+      handle.PrintLevel(1);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 1);
+      opt::handle_free(handle);
+      opt::handle_init(handle, 2);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 2);
+      // the cache is registered against the new handle
+      opt::CommE04RA borrowed(handle.handle);
+      borrowed.PrintLevel(3);
+      ASSERT_EQUAL(borrowed.get_PrintLevel(), 3);
+      ASSERT_EQUAL(handle.get_PrintLevel(), 3);
+    }
+    {
+      SUB_TEST("borrowed handle");
+      opt::CommE04RA borrowed(handle.handle);
+      ASSERT_FALSE(borrowed.check());
+      ASSERT_TRUE(borrowed.check_options());
+      ASSERT_THROWS(error_handler::ErrorException, opt::handle_free(borrowed));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_option_cache, "Test the option cache in CommE04RA");
+// clang-format on
+
+struct test_option_cache_in_monit : public TestCase {
+  void run() override {
+    opt::CommE04RA handle(2);
+    std::vector<double> c = {1.0, 1.0};
+    std::vector<double> bl = {0.0, 0.0}, bu = {1.0, 1.0};
+    opt::handle_set_linobj(handle, c);
+    opt::handle_set_simplebounds(handle, bl, bu);
+    handle.PrintLevel(0).LPIPMMonitorFrequency(1);
+    // populate the cache before the solve
+    ASSERT_EQUAL(handle.get_PrintLevel(), 0);
+
+    int ncalls = 0;
+    bool same_value = true;
+    auto monit =
+      [&](opt::CommE04RA &comm,
+          const utility::array1D<double, data_handling::ArgIntent::IntentIN>
+            &rinfo,
+          const utility::array1D<double, data_handling::ArgIntent::IntentIN>
+            &stats) {
+        ++ncalls;
+        same_value = same_value && (comm.get_PrintLevel() == 0) &&
+                     (comm.get_LPIPMMonitorFrequency() == 1);
+      };
+    std::vector<double> x, u, rinfo, stats;
+    opt::handle_solve_lp_ipm(handle, x, u, rinfo, stats, monit);
+    ASSERT_TRUE(ncalls > 0);
+    ASSERT_TRUE(same_value);
+  }
+};
+// clang-format off
+REGISTER_TEST(test_option_cache_in_monit, "Test the option cache is available in a monitoring function");
+// clang-format on
@@ -0,0 +1,110 @@
+// unit test for opt::ModelE04RA
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "e04/nagcpp_class_ModelE04RA.hpp"
+#include "e04/nagcpp_e04mt.hpp"
+#include "e04/nagcpp_e04rf.hpp"
+#include "e04/nagcpp_e04rh.hpp"
+#include "e04/nagcpp_e04rj.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  // LP problem taken from the e04mt example
+  types::f77_integer nvar = 7;
+  std::vector<types::f77_integer> idxc = {1, 2, 3, 4, 5, 6, 7};
+  std::vector<double> c = {-0.02, -0.20, -0.20, -0.20, -0.20, 0.04, 0.04};
+  std::vector<double> xl = {-0.01, -0.1, -0.01, -0.04, -0.1, -0.01, -0.01};
+  std::vector<double> xu = {0.01, 0.15, 0.03, 0.02, 0.05, 1.0e20, 1.0e20};
+  std::vector<double> bla = {-0.13,   -1.0e20, -1.0e20, -1.0e20,
+                             -1.0e20, -0.0992, -0.003};
+  std::vector<double> bua = {-0.13,   -0.0049, -0.0064, -0.0037,
+                             -0.0012, 1.0e20,  0.002};
+  std::vector<types::f77_integer> irowa = {
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4,
+    4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7};
+  std::vector<types::f77_integer> icola = {
+    1, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 1,
+    2, 3, 4, 5, 1, 2, 5, 1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<double> a = {
+    1.00, 1.00, 1.00, 1.00, 1.00, 1.00, 1.00, 0.15, 0.04, 0.02, 0.04,
+    0.02, 0.01, 0.03, 0.03, 0.05, 0.08, 0.02, 0.06, 0.01, 0.02, 0.04,
+    0.01, 0.02, 0.02, 0.02, 0.03, 0.01, 0.70, 0.75, 0.80, 0.75, 0.80,
+    0.97, 0.02, 0.06, 0.08, 0.12, 0.02, 0.01, 0.97};
+
+  void solve(opt::CommE04RA &handle, std::vector<double> &x,
+             std::vector<double> &rinfo) {
+    std::vector<double> u, stats;
+    opt::handle_solve_lp_ipm(handle, x, u, rinfo, stats, nullptr);
+  }
+}
+
+struct test_model_replay : public TestCase {
+  void run() override {
+    // define the problem directly
+    std::vector<double> ex, erinfo;
+    {
+      opt::CommE04RA handle(nvar);
+      opt::handle_set_quadobj(handle, idxc, c, nullptr, nullptr, nullptr);
+      opt::handle_set_simplebounds(handle, xl, xu);
+      opt::handle_set_linconstr(handle, bla, bua, irowa, icola, a);
+      handle.PrintLevel(0);
+      handle.LPIPMStopTolerance(1.0e-10);
+      solve(handle, ex, erinfo);
+    }
+
+    // ... and via a model, the arrays going out of scope before the
+    // model is used
+    opt::ModelE04RA model(nvar);
+    {
+      std::vector<double> lxl(xl), lxu(xu);
+      model.set_quadobj(idxc, c, nullptr, nullptr, nullptr)
+        .set_simplebounds(lxl, lxu)
+        .set_linconstr(bla, bua, irowa, icola, a)
+        .set("Print Level", 0)
+        .set("LP IPM Stop Tolerance = 1.0e-10");
+    }
+    ASSERT_EQUAL(model.size(), static_cast<size_t>(5));
+    ASSERT_EQUAL(model.get_nvar(), nvar);
+
+    {
+      SUB_TEST("created handles match the directly defined problem");
+      auto handles = model.create(3);
+      ASSERT_EQUAL(handles.size(), static_cast<size_t>(3));
+      for (auto &handle : handles) {
+        ASSERT_FLOATS_EQUAL(handle->get_LPIPMStopTolerance(), 1.0e-10);
+        std::vector<double> x, rinfo;
+        solve(*handle, x, rinfo);
+        ASSERT_ARRAY_FLOATS_EQUAL(nvar, x, ex);
+        ASSERT_FLOATS_EQUAL(rinfo[0], erinfo[0]);
+      }
+    }
+    {
+      SUB_TEST("created handles are independent");
+      auto handle1 = model.create();
+      auto handle2 = model.create();
+      // tighten the bounds in the first handle only
+      std::vector<double> txl(xl), txu(xu);
+      txu[1] = 0.0;
+      opt::handle_set_simplebounds(*handle1, txl, txu);
+      std::vector<double> x1, rinfo1, x2, rinfo2;
+      solve(*handle1, x1, rinfo1);
+      solve(*handle2, x2, rinfo2);
+      ASSERT_TRUE(x1[1] <= 1.0e-8);
+      ASSERT_ARRAY_FLOATS_EQUAL(nvar, x2, ex);
+    }
+    {
+      SUB_TEST("errors are raised when the call is recorded");
+      opt::ModelE04RA bad_model(nvar);
+      std::vector<double> bad_xu(xu);
+      bad_xu[0] = -1.0;
+      ASSERT_THROWS(error_handler::ErrorException,
+                    bad_model.set_simplebounds(xl, bad_xu));
+      ASSERT_EQUAL(bad_model.size(), static_cast<size_t>(0));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_model_replay, "Test creating handles from a ModelE04RA");
+// clang-format on
@@ -0,0 +1,170 @@
+// unit tests for quad::GaussRuleCache
+#include "d01/nagcpp_d01_gauss_rule_cache.hpp"
+#include "d01/nagcpp_d01tb.hpp"
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_error_handler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  struct RuleCase {
+    types::f77_integer key;
+    double a;
+    double b;
+  };
+  // one case for each key (and each sign of b or a+b where that changes
+  // the interval)
+  std::vector<RuleCase> rule_cases = {{0, -2.0, 3.0},  {0, 1.0, 0.5},
+                                      {3, 1.5, 2.0},   {3, 1.0, -0.5},
+                                      {-3, 1.5, 2.0},  {-3, -1.0, -4.0},
+                                      {4, 0.5, 2.0},   {-4, -1.0, 0.25},
+                                      {-5, 1.0, 2.0},  {-5, -3.0, 1.0}};
+
+  bool rules_agree(const std::vector<double> &x,
+                   const std::vector<double> &y) {
+    if (x.size() != y.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < x.size(); ++i) {
+      if (std::abs(x[i] - y[i]) > 1.0e-12 * std::max(1.0, std::abs(y[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+struct test_gauss_rule_cache : public TestCase {
+  void run() override {
+    types::f77_integer n = 8;
+    quad::GaussRuleCache cache;
+    {
+      SUB_TEST("agrees with dim1_gauss_wres");
+      for (const auto &rc : rule_cases) {
+        SUB_TITLE("key = " + std::to_string(rc.key));
+        std::vector<double> eweight, eabscis, weight, abscis;
+        quad::dim1_gauss_wres(rc.key, rc.a, rc.b, n, eweight, eabscis);
+        // the first call computes the rule, the second maps the stored rule
+        for (int i = 0; i < 2; ++i) {
+          cache.dim1_gauss_wres(rc.key, rc.a, rc.b, n, weight, abscis);
+          ASSERT_TRUE(rules_agree(weight, eweight));
+          ASSERT_TRUE(rules_agree(abscis, eabscis));
+        }
+      }
+      ASSERT_EQUAL(cache.get_nrules(), static_cast<size_t>(6));
+      ASSERT_EQUAL(cache.get_npoints(), static_cast<size_t>(6 * n));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(6));
+      ASSERT_EQUAL(cache.get_nhits(), 2 * rule_cases.size() - 6);
+    }
+    {
+      SUB_TEST("precompute");
+      cache.clear();
+      cache.precompute({0, -3}, {4, 8});
+      ASSERT_EQUAL(cache.get_nrules(), static_cast<size_t>(4));
+      ASSERT_EQUAL(cache.get_npoints(), static_cast<size_t>(24));
+      std::vector<double> weight(4), abscis(4);
+      cache.dim1_gauss_wres(-3, 0.0, 1.0, 4, weight, abscis);
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(1));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(0));
+    }
+    {
+      SUB_TEST("eviction");
+      quad::GaussRuleCache small_cache(20);
+      std::vector<double> weight, abscis;
+      small_cache.dim1_gauss_wres(0, 0.0, 1.0, n, weight, abscis);
+      small_cache.dim1_gauss_wres(4, 0.0, 1.0, n, weight, abscis);
+      // use the first rule again, so the second is the least recently used
+      small_cache.dim1_gauss_wres(0, 0.0, 2.0, n, weight, abscis);
+      small_cache.dim1_gauss_wres(-3, 0.0, 1.0, n, weight, abscis);
+      ASSERT_EQUAL(small_cache.get_nrules(), static_cast<size_t>(2));
+      ASSERT_EQUAL(small_cache.get_npoints(), static_cast<size_t>(16));
+      small_cache.dim1_gauss_wres(0, 0.0, 1.0, n, weight, abscis);
+      ASSERT_EQUAL(small_cache.get_nhits(), static_cast<size_t>(2));
+      small_cache.dim1_gauss_wres(4, 0.0, 1.0, n, weight, abscis);
+      ASSERT_EQUAL(small_cache.get_nmisses(), static_cast<size_t>(4));
+      small_cache.set_max_points(n);
+      ASSERT_EQUAL(small_cache.get_nrules(), static_cast<size_t>(1));
+      ASSERT_EQUAL(small_cache.get_max_points(), static_cast<size_t>(n));
+    }
+    {
+      SUB_TEST("rule that is not stored");
+      // the warning is raised on every call, as for dim1_gauss_wres
+      quad::OptionalD01TB opt;
+      opt.fail.error_handler_type =
+        error_handler::ErrorHandlerType::ThrowNothing;
+      std::vector<double> eweight, eabscis, weight, abscis;
+      quad::dim1_gauss_wres(0, 0.0, 1.0, 7, eweight, eabscis, opt);
+      ASSERT_EQUAL(opt.fail.errorid, 1);
+      for (int i = 0; i < 2; ++i) {
+        cache.dim1_gauss_wres(0, 0.0, 1.0, 7, weight, abscis, opt);
+        ASSERT_EQUAL(opt.fail.errorid, 1);
+        ASSERT_TRUE(rules_agree(weight, eweight));
+        ASSERT_TRUE(rules_agree(abscis, eabscis));
+      }
+    }
+    {
+      SUB_TEST("error exits");
+      std::vector<double> weight, abscis;
+      ASSERT_THROWS(error_handler::ErrorException,
+                    cache.dim1_gauss_wres(1, 0.0, 1.0, n, weight, abscis));
+      ASSERT_THROWS(error_handler::ErrorException,
+                    cache.dim1_gauss_wres(4, 0.0, -1.0, n, weight, abscis));
+      ASSERT_THROWS(error_handler::ErrorException,
+                    cache.dim1_gauss_wres(0, 0.0, 1.0, 0, weight, abscis));
+      ASSERT_THROWS(error_handler::ErrorException, cache.precompute(1, n));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_gauss_rule_cache, "Test GaussRuleCache");
+// clang-format on
+
+struct test_gauss_rule_cache_threads : public TestCase {
+  void run() override {
+    types::f77_integer n = 16;
+    std::vector<std::vector<double>> eweight(rule_cases.size()),
+      eabscis(rule_cases.size());
+    for (size_t j = 0; j < rule_cases.size(); ++j) {
+      quad::dim1_gauss_wres(rule_cases[j].key, rule_cases[j].a,
+                            rule_cases[j].b, n, eweight[j], eabscis[j]);
+    }
+    // small enough that rules are evicted while the threads are running
+    quad::GaussRuleCache cache(3 * n);
+    int nthreads = 4;
+    int nloops = 200;
+    std::vector<int> nfailed(nthreads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; ++t) {
+      threads.emplace_back([&, t] {
+        std::vector<double> weight, abscis;
+        for (int i = 0; i < nloops; ++i) {
+          size_t j = static_cast<size_t>(i + t) % rule_cases.size();
+          cache.dim1_gauss_wres(rule_cases[j].key, rule_cases[j].a,
+                                rule_cases[j].b, n, weight, abscis);
+          if (!rules_agree(weight, eweight[j]) ||
+              !rules_agree(abscis, eabscis[j])) {
+            ++nfailed[t];
+          }
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    for (int t = 0; t < nthreads; ++t) {
+      ASSERT_EQUAL(nfailed[t], 0);
+    }
+    ASSERT_EQUAL(cache.get_nhits() + cache.get_nmisses(),
+                 static_cast<size_t>(nthreads * nloops));
+    ASSERT_TRUE(cache.get_npoints() <= static_cast<size_t>(3 * n));
+  }
+};
+// clang-format off
+REGISTER_TEST(test_gauss_rule_cache_threads, "Test GaussRuleCache from several threads");
+// clang-format on
@@ -3,6 +3,11 @@
 #include "d01/nagcpp_d01tb.hpp"
 #include "include/cxxunit_testing.hpp"
 #include "utility/nagcpp_error_handler.hpp"
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <type_traits>
 
@@ -102,6 +107,36 @@ struct test_simple_example : public TestCase {
 REGISTER_TEST(test_simple_example, "Test simple example");
 // clang-format on
 
+struct test_callback_profiler : public TestCase {
+  void run() override {
+    std::vector<double> weight(example::weight);
+    std::vector<double> abscis(example::abscis);
+    quad::OptionalD01FB opt;
+    opt.callback_profiler = std::make_shared<utility::CallbackProfiler>();
+    double mdint = quad::md_gauss(example::nptvec, weight, abscis, f, opt);
+    ASSERT_FLOATS_EQUAL(mdint, example::mdint);
+
+    const utility::CallbackProfile &profile =
+      opt.callback_profiler->get_profile();
+    ASSERT_EQUAL(profile.callbacks.size(), static_cast<size_t>(1));
+    const utility::CallbackTiming *timing = profile.get("f");
+    ASSERT_TRUE(timing != nullptr);
+    if (last_assert_passed) {
+      // one call per point of the product rule
+      size_t npts = 1;
+      for (auto n : example::nptvec)
+        npts *= static_cast<size_t>(n);
+      ASSERT_EQUAL(timing->ncalls, npts);
+      ASSERT_TRUE(timing->min_time <= timing->max_time);
+      ASSERT_TRUE(timing->total_time <= profile.total_time);
+    }
+    ASSERT_TRUE(profile.engine_time >= 0.0);
+  }
+};
+// clang-format off
+REGISTER_TEST(test_callback_profiler, "Test the callback profiler");
+// clang-format on
+
 // NAG defined type as its arguments ...
 // C like function
 double clike_arr(const utility::array1D<double, data_handling::ArgIntent::IntentIN> &x) {
@@ -341,3 +376,98 @@ struct test_error_exits : TestCase {
 // clang-format off
 REGISTER_TEST(test_error_exits, "Test error exits");
 // clang-format on
+
+// batched version of f, the coordinates of point i are in x[j*npts+i]
+void f_batch(const types::f77_integer ndim, const types::f77_integer npts,
+             const utility::vector_view<const double> &x,
+             utility::vector_view<double> &fx) {
+  std::vector<double> xi(ndim);
+  for (types::f77_integer i = 0; i < npts; ++i) {
+    for (types::f77_integer j = 0; j < ndim; ++j) {
+      xi[j] = x[j * npts + i];
+    }
+    fx[i] = f_base(xi);
+  }
+}
+
+struct test_md_gauss_batch : public TestCase {
+  void run() override {
+    // 4^4 = 256 points in the product rule
+    for (types::f77_integer batch_size : {1, 7, 256, 4096}) {
+      for (int nthreads : {1, 3}) {
+        SUB_TEST("batch_size = " + std::to_string(batch_size) +
+                 ", nthreads = " + std::to_string(nthreads));
+        quad::OptionalD01FBBatch opt;
+        opt.batch_size(batch_size).nthreads(nthreads);
+        opt.callback_profiler = std::make_shared<utility::CallbackProfiler>();
+        double mdint = quad::md_gauss_batch(
+          example::nptvec, example::weight, example::abscis, f_batch, opt);
+        ASSERT_TRUE(std::abs(mdint - example::mdint) <=
+                    1.0e-13 * std::abs(example::mdint));
+        size_t nbatches = (256 + batch_size - 1) / batch_size;
+        const utility::CallbackTiming *timing =
+          opt.callback_profiler->get_profile().get("f");
+        ASSERT_EQUAL(timing->ncalls, nbatches);
+      }
+    }
+    {
+      SUB_TEST("alt-1");
+      double mdint = quad::md_gauss_batch(example::nptvec, example::weight,
+                                          example::abscis, f_batch);
+      ASSERT_TRUE(std::abs(mdint - example::mdint) <=
+                  1.0e-13 * std::abs(example::mdint));
+    }
+    {
+      SUB_TITLE("lwa too small");
+      std::vector<double> weight(15, 1);
+      std::vector<double> abscis(15, 1);
+      quad::OptionalD01FBBatch opt;
+      opt.fail.error_handler_type =
+        error_handler::ErrorHandlerType::ThrowNothing;
+      ASSERT_THROWS_NOTHING(
+        quad::md_gauss_batch(example::nptvec, weight, abscis, f_batch, opt));
+      ASSERT_TRUE(opt.fail.error_thrown);
+      ASSERT_EQUAL(opt.fail.errorid, 1);
+      ASSERT_HAS_KEYWORD(opt.fail.msg, "lwa = 15");
+      ASSERT_HAS_KEYWORD(opt.fail.msg, "dimension: 16");
+    }
+    {
+      SUB_TITLE("too many points");
+      types::f77_integer nmax = std::numeric_limits<types::f77_integer>::max();
+      std::vector<types::f77_integer> nptvec(4, nmax);
+      quad::OptionalD01FBBatch opt;
+      opt.fail.error_handler_type =
+        error_handler::ErrorHandlerType::ThrowNothing;
+      ASSERT_THROWS_NOTHING(quad::md_gauss_batch(
+        nptvec, example::weight, example::abscis, f_batch, opt));
+      ASSERT_TRUE(opt.fail.error_thrown);
+      ASSERT_EQUAL(opt.fail.errorid, 1);
+      ASSERT_HAS_KEYWORD(opt.fail.msg, "too many points");
+    }
+    {
+      SUB_TITLE("invalid batch_size");
+      quad::OptionalD01FBBatch opt;
+      opt.batch_size(0);
+      ASSERT_THROWS(error_handler::ErrorException,
+                    quad::md_gauss_batch(example::nptvec, example::weight,
+                                         example::abscis, f_batch, opt));
+    }
+    {
+      SUB_TITLE("exception in the callback");
+      auto f_throws = [](const types::f77_integer ndim,
+                         const types::f77_integer npts,
+                         const utility::vector_view<const double> &x,
+                         utility::vector_view<double> &fx) {
+        throw std::runtime_error("integrand failed");
+      };
+      quad::OptionalD01FBBatch opt;
+      opt.batch_size(16).nthreads(2);
+      ASSERT_THROWS(error_handler::CallbackException,
+                    quad::md_gauss_batch(example::nptvec, example::weight,
+                                         example::abscis, f_throws, opt));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_md_gauss_batch, "Test md_gauss_batch against md_gauss");
+// clang-format on
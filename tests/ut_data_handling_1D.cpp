@@ -289,6 +289,12 @@ struct test_setup {
   run_this<types::f77_integer, data_handling::ArgIntent::IntentIN, utility::array1D<types::f77_integer, data_handling::ArgIntent::IntentIN>, ut::TYPE_IS::CONST_DATA_POINTER>("ut::array1D<f77_integer, IntentIN>, f77_integer, IntentIN"); \
   run_this<types::f77_integer, data_handling::ArgIntent::IntentOUT, utility::array1D<types::f77_integer, data_handling::ArgIntent::IntentOUT>, ut::TYPE_IS::CONST_DATA_POINTER>("ut::array1D<f77_integer, IntentOUT>, f77_integer, IntentOUT"); \
   run_this<types::f77_integer, data_handling::ArgIntent::IntentINOUT, utility::array1D<types::f77_integer, data_handling::ArgIntent::IntentINOUT>, ut::TYPE_IS::CONST_DATA_POINTER>("ut::array1D<f77_integer, IntentINOUT>, f77_integer, IntentINOUT"); \
+  run_this<double, data_handling::ArgIntent::IntentIN, utility::vector_view<const double>>("ut::vector_view<const double>, double, IntentIN"); \
+  run_this<double, data_handling::ArgIntent::IntentOUT, utility::vector_view<double>>("ut::vector_view<double>, double, IntentOUT"); \
+  run_this<double, data_handling::ArgIntent::IntentINOUT, utility::vector_view<double>>("ut::vector_view<double>, double, IntentINOUT"); \
+  run_this<types::f77_integer, data_handling::ArgIntent::IntentIN, utility::vector_view<const types::f77_integer>>("ut::vector_view<const f77_integer>, f77_integer, IntentIN"); \
+  run_this<types::f77_integer, data_handling::ArgIntent::IntentOUT, utility::vector_view<types::f77_integer>>("ut::vector_view<f77_integer>, f77_integer, IntentOUT"); \
+  run_this<types::f77_integer, data_handling::ArgIntent::IntentINOUT, utility::vector_view<types::f77_integer>>("ut::vector_view<f77_integer>, f77_integer, IntentINOUT"); \
   BOOST_1D_TYPES_TO_TEST_WRAPPERS
 
 // #defines for internal types (these are not expected to be used as
@@ -1087,3 +1093,96 @@ struct test_convert_nag_array_to_user : public TestCase {
 REGISTER_TEST(test_convert_nag_array_to_user, "Test auto discovery and conversion of NAG array type to users type");
 // clang-format on
 // ... tests related to using the type as an argument to a NAG callback function
+
+//************************************************
+struct test_convert_nag_array_to_vector_view : public TestCase {
+  void run() override {
+    static const size_t n1 = 7;
+    std::vector<double> raw_data = ut::get_expected_values<double>(n1);
+    {
+      SUB_TEST("IntentIN: view points at the NAG array");
+      const utility::array1D<double, data_handling::ArgIntent::IntentIN>
+        local_x(raw_data.data(), n1);
+      auto user_x = data_handling::convert_nag_array_to_user<
+        const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
+        data_handling::ArgIntent::IntentIN,
+        const utility::vector_view<const double> &>(local_x);
+      ASSERT_TRUE(user_x.get().data() == raw_data.data());
+      ASSERT_EQUAL(user_x.get().size(), n1);
+    }
+    {
+      SUB_TEST("IntentINOUT: updates are made in place");
+      utility::array1D<double, data_handling::ArgIntent::IntentINOUT> local_x(
+        raw_data.data(), n1);
+      auto user_x = data_handling::convert_nag_array_to_user<
+        utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
+        data_handling::ArgIntent::IntentINOUT, utility::vector_view<double> &>(
+        local_x);
+      ASSERT_TRUE(user_x.get().data() == raw_data.data());
+      for (auto &xi : user_x.get()) {
+        xi = -xi;
+      }
+      // no copy back is required, so the change is visible immediately
+      std::vector<double> expected_results =
+        ut::get_expected_values<double>(n1);
+      for (size_t i = 0; i < n1; ++i) {
+        ASSERT_EQUAL(raw_data[i], -expected_results[i]);
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_convert_nag_array_to_vector_view, "Test conversion of NAG array to vector_view does not copy");
+// clang-format on
+
+//************************************************
+struct test_convert_nag_array_to_user_with_scratch : public TestCase {
+  void run() override {
+    static const size_t n1 = 9;
+    std::vector<double> raw_x = ut::get_expected_values<double>(n1);
+    std::vector<double> raw_g(n1, 0.0);
+    data_handling::CallbackScratch scratch;
+    const utility::array1D<double, data_handling::ArgIntent::IntentIN> local_x(
+      raw_x.data(), n1);
+    utility::array1D<double, data_handling::ArgIntent::IntentINOUT> local_g(
+      raw_g.data(), n1);
+    for (int iter = 0; iter < 5; ++iter) {
+      // simulate repeated calls to a callback taking std::vector arguments
+      auto user_x = data_handling::convert_nag_array_to_user<
+        const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
+        data_handling::ArgIntent::IntentIN, const std::vector<double> &>(
+        local_x, scratch);
+      auto user_g = data_handling::convert_nag_array_to_user<
+        utility::array1D<double, data_handling::ArgIntent::IntentINOUT>,
+        data_handling::ArgIntent::IntentINOUT, std::vector<double> &>(
+        local_g, scratch);
+      for (size_t i = 0; i < n1; ++i) {
+        user_g.get()[i] += user_x.get()[i];
+      }
+    }
+    {
+      SUB_TEST("data copied back");
+      std::vector<double> expected_results = ut::get_expected_values<double>(n1);
+      for (size_t i = 0; i < n1; ++i) {
+        expected_results[i] *= 5;
+      }
+      ASSERT_ARRAY_FLOATS_EQUAL(n1, raw_g, expected_results);
+    }
+    {
+      SUB_TEST("scratch containers are reused");
+      ASSERT_EQUAL(scratch.allocations(), static_cast<size_t>(2));
+    }
+    {
+      SUB_TEST("types without scratch support fall back");
+      auto user_x = data_handling::convert_nag_array_to_user<
+        const utility::array1D<double, data_handling::ArgIntent::IntentIN>,
+        data_handling::ArgIntent::IntentIN, utility::vector_view<const double>>(
+        local_x, scratch);
+      ASSERT_TRUE(user_x.get().data() == raw_x.data());
+      ASSERT_EQUAL(scratch.allocations(), static_cast<size_t>(2));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_convert_nag_array_to_user_with_scratch, "Test conversion of NAG array to users type reuses scratch containers");
+// clang-format on
@@ -1331,3 +1331,178 @@ struct test_convert_nag_array_to_user : public TestCase {
 REGISTER_TEST(test_convert_nag_array_to_user, "Test auto discovery and conversion of NAG array type to users type");
 // clang-format on
 // ... tests related to using the type as an argument to a NAG callback function
+
+//************************************************
+struct test_leading_dimension_from_container : public TestCase {
+  void run() override {
+    // 5 x 4 column major matrix, of which we use rows 1 to 3 and columns
+    // 1 to 2
+    static const size_t ld = 5, n2 = 4;
+    static const size_t bn1 = 3, bn2 = 2;
+    std::vector<double> full = ut::get_expected_values<double>(ld * n2);
+    double *block_start = full.data() + ld + 1;
+    {
+      SUB_TEST("strided block is used directly");
+      utility::array2D<double> block(block_start, bn1, bn2, true, ld);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             utility::array2D<double>>
+        local_block(block, data_handling::UseLD());
+      ASSERT_TRUE(local_block.data == block_start);
+      ASSERT_EQUAL(local_block.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(ld));
+      for (size_t j = 0; j < bn2; ++j) {
+        for (size_t i = 0; i < bn1; ++i) {
+          ASSERT_EQUAL(local_block(i, j), full[(j + 1) * ld + i + 1]);
+        }
+      }
+      nagcpp::error_handler::ErrorHandler eh;
+      local_block.check(eh, "block", true, constants::NAG_ED_COL_MAJOR,
+                        static_cast<types::f77_integer>(bn1),
+                        static_cast<types::f77_integer>(bn2));
+      ASSERT_FALSE(eh.error_thrown);
+    }
+    {
+      SUB_TEST("contiguous array2D does not set a leading dimension");
+      utility::array2D<double> whole(full.data(), ld, n2);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             utility::array2D<double>>
+        local_whole(whole);
+      ASSERT_EQUAL(local_whole.get_LD(constants::NAG_ED_COL_MAJOR, 7),
+                   static_cast<types::f77_integer>(7));
+      ASSERT_EQUAL(local_whole.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(ld));
+    }
+    {
+      SUB_TEST("strided block with conversion keeps the layout");
+      std::vector<float> ffull(full.begin(), full.end());
+      utility::array2D<float> fblock(ffull.data() + ld + 1, bn1, bn2, true,
+                                     ld);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             utility::array2D<float>>
+        local_fblock(fblock, data_handling::UseLD());
+      ASSERT_EQUAL(local_fblock.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(ld));
+      local_fblock(2, 1) = -1.0;
+      local_fblock.copy_back(fblock);
+      ASSERT_EQUAL(ffull[2 * ld + 3], -1.0f);
+      ASSERT_EQUAL(ffull[2 * ld + 4], static_cast<float>(full[2 * ld + 4]));
+    }
+    {
+      SUB_TEST("strided block is packed if the leading dimension is unused");
+      std::vector<double> cfull(full);
+      utility::array2D<double> block(cfull.data() + ld + 1, bn1, bn2, true,
+                                     ld);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             utility::array2D<double>>
+        local_block(block);
+      ASSERT_TRUE(local_block.data != cfull.data() + ld + 1);
+      ASSERT_EQUAL(local_block.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(bn1));
+      for (size_t j = 0; j < bn2; ++j) {
+        for (size_t i = 0; i < bn1; ++i) {
+          ASSERT_EQUAL(local_block.data[j * bn1 + i],
+                       full[(j + 1) * ld + i + 1]);
+        }
+      }
+      local_block.data[bn1 * bn2 - 1] = -1.0;
+      local_block.copy_back(block);
+      ASSERT_EQUAL(cfull[2 * ld + 3], -1.0);
+      // elements outside the block are untouched
+      ASSERT_EQUAL(cfull[2 * ld + 4], full[2 * ld + 4]);
+      ASSERT_EQUAL(cfull[2 * ld], full[2 * ld]);
+    }
+    {
+      SUB_TEST("leading dimension is cleared for contiguous data");
+      utility::array2D<double> block(block_start, bn1, bn2, true, ld);
+      utility::array2D<double> whole(full.data(), ld, n2);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             utility::array2D<double>>
+        local_array(block, data_handling::UseLD());
+      ASSERT_EQUAL(local_array.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(ld));
+      local_array.get_data(whole);
+      ASSERT_EQUAL(local_array.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(ld));
+      ASSERT_EQUAL(local_array(1, 2), full[2 * ld + 1]);
+      utility::array2D<double> small(full.data(), bn1, bn2);
+      local_array.get_data(small);
+      ASSERT_EQUAL(local_array.get_LD(constants::NAG_ED_COL_MAJOR),
+                   static_cast<types::f77_integer>(bn1));
+      ASSERT_EQUAL(local_array(1, 1), full[bn1 + 1]);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_leading_dimension_from_container, "Test leading dimension is taken from the users container");
+// clang-format on
+
+#ifdef HAVE_BOOST_MATRIX
+//************************************************
+struct test_boost_matrix_contiguous_storage : public TestCase {
+  void run() override {
+    using BM_COL =
+      boost::numeric::ublas::matrix<double, boost::numeric::ublas::column_major>;
+    using BM_ROW =
+      boost::numeric::ublas::matrix<double, boost::numeric::ublas::row_major>;
+    using BM_BOUNDED = boost::numeric::ublas::matrix<
+      double, boost::numeric::ublas::column_major,
+      boost::numeric::ublas::bounded_array<double, 20>>;
+    {
+      SUB_TEST("column major matrix is used directly");
+      BM_COL m(4, 3);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             BM_COL>
+        local_m(m);
+      ASSERT_TRUE(local_m.data == &m.data()[0]);
+      local_m(2, 1) = 15.0;
+      ASSERT_EQUAL(m(2, 1), 15.0);
+    }
+    {
+      SUB_TEST("row major matrix is used directly");
+      BM_ROW m(4, 3);
+      const BM_ROW &cm = m;
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN, BM_ROW>
+        local_m(cm);
+      ASSERT_TRUE(local_m.data == &m.data()[0]);
+    }
+    {
+      SUB_TEST("bounded storage is used directly");
+      BM_BOUNDED m(4, 3);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             BM_BOUNDED>
+        local_m(m);
+      ASSERT_TRUE(local_m.data == &m.data()[0]);
+    }
+    {
+      SUB_TEST("const matrix passed to output argument is copied");
+      BM_COL m(4, 3);
+      const BM_COL &cm = m;
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             BM_COL>
+        local_m(cm);
+      ASSERT_FALSE(local_m.data == &m.data()[0]);
+    }
+    {
+      SUB_TEST("resize and copy back of output argument");
+      BM_COL m;
+      data_handling::RawData<double, data_handling::ArgIntent::IntentOUT,
+                             BM_COL>
+        local_m(m);
+      local_m.resize(m, 4, 3);
+      ASSERT_TRUE(local_m.data == &m.data()[0]);
+      for (size_t j = 0; j < 3; ++j) {
+        for (size_t i = 0; i < 4; ++i) {
+          local_m(i, j) = static_cast<double>(10 * i + j);
+        }
+      }
+      local_m.copy_back(m, 2, 3);
+      ASSERT_EQUAL(m.size1(), static_cast<size_t>(2));
+      ASSERT_EQUAL(m.size2(), static_cast<size_t>(3));
+      ASSERT_EQUAL(m(1, 2), 12.0);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_boost_matrix_contiguous_storage, "Test boost matrices with contiguous storage are not copied");
+// clang-format on
+#endif
@@ -0,0 +1,57 @@
+#include "e02/nagcpp_e02bb.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_multi_point_matches_single_point : public TestCase {
+  void run() override {
+    std::vector<double> lamda = {1.0, 1.0, 1.0, 1.0, 3.0, 6.0,
+                                 8.0, 9.0, 9.0, 9.0, 9.0};
+    std::vector<double> c = {1.0, 2.0, 4.0, 7.0, 6.0, 4.0, 3.0};
+    c.resize(lamda.size());
+    // unsorted points
+    std::vector<double> x = {5.0, 1.0, 9.0, 2.5, 7.25, 3.0, 8.5, 1.5};
+    std::vector<double> es(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      fit::dim1_spline_eval(lamda, c, x[i], es[i]);
+    }
+    {
+      SUB_TEST("single thread");
+      std::vector<double> s;
+      fit::dim1_spline_eval(lamda, c, x, s);
+      ASSERT_ARRAY_FLOATS_EQUAL(es.size(), es, s);
+    }
+    {
+      SUB_TEST("multiple threads");
+      std::vector<double> s;
+      fit::OptionalE02BB opt;
+      opt.nthreads(3);
+      fit::dim1_spline_eval(lamda, c, x, s, opt);
+      ASSERT_ARRAY_FLOATS_EQUAL(es.size(), es, s);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_multi_point_matches_single_point, "Test multi-point interface matches single point interface");
+// clang-format on
+
+struct test_multi_point_out_of_range : public TestCase {
+  void run() override {
+    std::vector<double> lamda = {1.0, 1.0, 1.0, 1.0, 3.0, 6.0,
+                                 8.0, 9.0, 9.0, 9.0, 9.0};
+    std::vector<double> c = {1.0, 2.0, 4.0, 7.0, 6.0, 4.0, 3.0};
+    c.resize(lamda.size());
+    std::vector<double> x = {2.0, 10.0, 0.0};
+    std::vector<double> s;
+    fit::OptionalE02BB opt;
+    opt.fail.error_handler_type = error_handler::ErrorHandlerType::ThrowNothing;
+    fit::dim1_spline_eval(lamda, c, x, s, opt);
+    ASSERT_TRUE(opt.fail.error_thrown);
+    ASSERT_EQUAL(opt.fail.errorid, 1);
+    ASSERT_HAS_KEYWORD(opt.fail.msg, "x <= lamda[ncap7-4]");
+  }
+};
+// clang-format off
+REGISTER_TEST(test_multi_point_out_of_range, "Test multi-point interface reports the first failing point");
+// clang-format on
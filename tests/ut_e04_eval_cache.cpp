@@ -0,0 +1,157 @@
+// unit test for opt::ObjectiveEvaluationCache and
+// opt::ConstraintEvaluationCache
+#include "e04/nagcpp_e04_eval_cache.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <stdexcept>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_objective_evaluation_cache : public TestCase {
+  void run() override {
+    // f(x) = x_0^2 + 3 x_1, with an evaluation counter
+    int nevals = 0;
+    bool fail = false;
+    bool throw_error = false;
+    auto objfg = [&](const utility::vector_view<const double> &x, double &fx,
+                     utility::vector_view<double> &fdx,
+                     types::f77_integer &inform) {
+      ++nevals;
+      if (throw_error) {
+        throw std::runtime_error("objfg");
+      }
+      if (fail) {
+        inform = -1;
+        return;
+      }
+      fx = x[0] * x[0] + 3.0 * x[1];
+      fdx[0] = 2.0 * x[0];
+      fdx[1] = 3.0;
+    };
+    opt::ObjectiveEvaluationCache<decltype(objfg)> cache(objfg, 2);
+    auto objfun = cache.objfun();
+    auto objgrd = cache.objgrd();
+
+    std::vector<double> x = {2.0, 1.0};
+    utility::vector_view<const double> xv(x);
+    std::vector<double> fdx(2, 0.0);
+    utility::vector_view<double> fdxv(fdx);
+    double fx = 0.0;
+    types::f77_integer inform = 0;
+    {
+      SUB_TEST("objfun then objgrd at the same point");
+      objfun(xv, fx, inform);
+      objgrd(xv, fdxv, inform);
+      ASSERT_EQUAL(inform, 0);
+      ASSERT_FLOATS_EQUAL(fx, 7.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], 4.0);
+      ASSERT_FLOATS_EQUAL(fdx[1], 3.0);
+      ASSERT_EQUAL(nevals, 1);
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(1));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(1));
+    }
+    {
+      SUB_TEST("a new point");
+      x[0] = -1.0;
+      objgrd(xv, fdxv, inform);
+      objfun(xv, fx, inform);
+      objfun(xv, fx, inform);
+      ASSERT_FLOATS_EQUAL(fx, 4.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], -2.0);
+      ASSERT_EQUAL(nevals, 2);
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(3));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(2));
+    }
+    {
+      SUB_TEST("failed evaluations are not cached");
+      x[1] = 5.0;
+      fail = true;
+      objfun(xv, fx, inform);
+      ASSERT_EQUAL(inform, -1);
+      fail = false;
+      inform = 0;
+      objfun(xv, fx, inform);
+      ASSERT_EQUAL(inform, 0);
+      ASSERT_FLOATS_EQUAL(fx, 16.0);
+      ASSERT_EQUAL(nevals, 4);
+    }
+    {
+      SUB_TEST("nlp1 objfun");
+      cache.clear();
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(0));
+      auto nlp1_objfun = cache.nlp1_objfun();
+      fx = 0.0;
+      fdx.assign(2, 0.0);
+      nlp1_objfun(0, xv, fx, fdxv, 1);
+      ASSERT_FLOATS_EQUAL(fx, 16.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], 0.0);
+      nlp1_objfun(1, xv, fx, fdxv, 0);
+      ASSERT_FLOATS_EQUAL(fdx[0], -2.0);
+      ASSERT_EQUAL(nevals, 5);
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(1));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(1));
+    }
+    {
+      SUB_TEST("evaluations that throw are not cached");
+      x[1] = 6.0;
+      throw_error = true;
+      ASSERT_THROWS(std::runtime_error, objfun(xv, fx, inform));
+      throw_error = false;
+      inform = 0;
+      objfun(xv, fx, inform);
+      ASSERT_EQUAL(inform, 0);
+      ASSERT_FLOATS_EQUAL(fx, 19.0);
+      ASSERT_EQUAL(nevals, 7);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_objective_evaluation_cache, "Test ObjectiveEvaluationCache");
+// clang-format on
+
+struct test_constraint_evaluation_cache : public TestCase {
+  void run() override {
+    // g(x) = (x_0 x_1, x_1^2), Jacobian nonzeros (1,1), (1,2), (2,2)
+    int nevals = 0;
+    auto confg = [&](const utility::vector_view<const double> &x,
+                     const types::f77_integer ncnln,
+                     utility::vector_view<double> &gx,
+                     utility::vector_view<double> &gdx,
+                     types::f77_integer &inform) {
+      ++nevals;
+      gx[0] = x[0] * x[1];
+      gx[1] = x[1] * x[1];
+      gdx[0] = x[1];
+      gdx[1] = x[0];
+      gdx[2] = 2.0 * x[1];
+    };
+    opt::ConstraintEvaluationCache<decltype(confg)> cache(confg, 2, 3);
+    auto confun = cache.confun();
+    auto congrd = cache.congrd();
+
+    std::vector<double> x = {2.0, 3.0};
+    utility::vector_view<const double> xv(x);
+    std::vector<double> gx(2, 0.0), gdx(3, 0.0);
+    utility::vector_view<double> gxv(gx), gdxv(gdx);
+    types::f77_integer inform = 0;
+    confun(xv, 2, gxv, inform);
+    congrd(xv, gdxv, inform);
+    ASSERT_EQUAL(inform, 0);
+    ASSERT_FLOATS_EQUAL(gx[0], 6.0);
+    ASSERT_FLOATS_EQUAL(gx[1], 9.0);
+    ASSERT_FLOATS_EQUAL(gdx[0], 3.0);
+    ASSERT_FLOATS_EQUAL(gdx[1], 2.0);
+    ASSERT_FLOATS_EQUAL(gdx[2], 6.0);
+    ASSERT_EQUAL(nevals, 1);
+    ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(1));
+
+    x[1] = -3.0;
+    congrd(xv, gdxv, inform);
+    ASSERT_FLOATS_EQUAL(gdx[2], -6.0);
+    ASSERT_EQUAL(nevals, 2);
+    ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(2));
+  }
+};
+// clang-format off
+REGISTER_TEST(test_constraint_evaluation_cache, "Test ConstraintEvaluationCache");
+// clang-format on
@@ -0,0 +1,196 @@
+// unit test for opt::FDObjectiveGradient and opt::FDConstraintJacobian
+#include "e04/nagcpp_e04_fd_gradient.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  // f(x) = sum_i (i+1) * x_i^2 + x_0 * x_{n-1}
+  void objfun(const utility::vector_view<const double> &x, double &fx,
+              types::f77_integer &inform) {
+    size_t n = x.size();
+    fx = x[0] * x[n - 1];
+    for (size_t i = 0; i < n; ++i) {
+      fx += static_cast<double>(i + 1) * x[i] * x[i];
+    }
+  }
+  double dobjfun(const std::vector<double> &x, size_t i) {
+    size_t n = x.size();
+    double g = 2.0 * static_cast<double>(i + 1) * x[i];
+    if (i == 0) {
+      g += x[n - 1];
+    }
+    if (i == n - 1) {
+      g += x[0];
+    }
+    return g;
+  }
+
+  // g_i(x) = x_i^2 + x_i * x_{i+1}, i = 0, ..., n - 2 (a bidiagonal
+  // Jacobian) and g_{n-1}(x) = sum_i x_i (a dense row)
+  void confun(const utility::vector_view<const double> &x,
+              const types::f77_integer ncnln, utility::vector_view<double> &gx,
+              types::f77_integer &inform) {
+    size_t n = x.size();
+    for (size_t i = 0; i + 1 < n; ++i) {
+      gx[i] = x[i] * x[i] + x[i] * x[i + 1];
+    }
+    if (static_cast<size_t>(ncnln) == n) {
+      gx[n - 1] = 0.0;
+      for (size_t i = 0; i < n; ++i) {
+        gx[n - 1] += x[i];
+      }
+    }
+  }
+}
+
+struct test_fd_objective_gradient : public TestCase {
+  void run() override {
+    size_t n = 7;
+    std::vector<double> x = {1.0, -2.0, 0.5, 3.0, -1.5, 0.25, 2.0};
+    utility::vector_view<const double> xv(x);
+
+    for (bool central : {false, true}) {
+      for (int nthreads : {1, 3}) {
+        SUB_TEST(std::string(central ? "central" : "forward") +
+                 ", nthreads = " + std::to_string(nthreads));
+        double tol = central ? 1.0e-8 : 1.0e-5;
+        opt::OptionalFDGradient opt;
+        opt.nthreads(nthreads).central(central);
+        {
+          // dense gradient
+          opt::FDObjectiveGradient<decltype(&objfun)> objgrd(
+            objfun, std::vector<types::f77_integer>(), opt);
+          std::vector<double> fdx(n, 0.0);
+          utility::vector_view<double> fdxv(fdx);
+          types::f77_integer inform = 0;
+          objgrd(xv, fdxv, inform);
+          ASSERT_EQUAL(inform, 0);
+          for (size_t i = 0; i < n; ++i) {
+            ASSERT_TRUE(std::abs(fdx[i] - dobjfun(x, i)) <= tol);
+          }
+        }
+        {
+          // a subset of the gradient
+          std::vector<types::f77_integer> idxfd = {2, 5, 7};
+          opt::FDObjectiveGradient<decltype(&objfun)> objgrd(objfun, idxfd,
+                                                              opt);
+          std::vector<double> fdx(idxfd.size(), 0.0);
+          utility::vector_view<double> fdxv(fdx);
+          types::f77_integer inform = 0;
+          objgrd(xv, fdxv, inform);
+          ASSERT_EQUAL(inform, 0);
+          for (size_t k = 0; k < idxfd.size(); ++k) {
+            ASSERT_TRUE(std::abs(fdx[k] - dobjfun(x, idxfd[k] - 1)) <= tol);
+          }
+        }
+      }
+    }
+    {
+      SUB_TEST("inform");
+      std::atomic<int> ncalls(0);
+      auto failing_objfun = [&ncalls](
+                              const utility::vector_view<const double> &x,
+                              double &fx, types::f77_integer &inform) {
+        fx = x[0];
+        if (++ncalls > 2) {
+          inform = -1;
+        }
+      };
+      opt::OptionalFDGradient opt;
+      opt.nthreads(2);
+      opt::FDObjectiveGradient<decltype(failing_objfun)> objgrd(
+        failing_objfun, std::vector<types::f77_integer>(), opt);
+      std::vector<double> fdx(n, 0.0);
+      utility::vector_view<double> fdxv(fdx);
+      types::f77_integer inform = 0;
+      objgrd(xv, fdxv, inform);
+      ASSERT_EQUAL(inform, -1);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_fd_objective_gradient, "Test FDObjectiveGradient against the analytic gradient");
+// clang-format on
+
+struct test_fd_constraint_jacobian : public TestCase {
+  void run() override {
+    size_t n = 8;
+    std::vector<double> x = {1.0, -2.0, 0.5, 3.0, -1.5, 0.25, 2.0, -0.75};
+    utility::vector_view<const double> xv(x);
+
+    // bidiagonal rows only ...
+    std::vector<types::f77_integer> irowgd, icolgd;
+    std::vector<double> egdx;
+    for (size_t i = 0; i + 1 < n; ++i) {
+      irowgd.push_back(static_cast<types::f77_integer>(i + 1));
+      icolgd.push_back(static_cast<types::f77_integer>(i + 1));
+      egdx.push_back(2.0 * x[i] + x[i + 1]);
+      irowgd.push_back(static_cast<types::f77_integer>(i + 1));
+      icolgd.push_back(static_cast<types::f77_integer>(i + 2));
+      egdx.push_back(x[i]);
+    }
+    types::f77_integer ncnln = static_cast<types::f77_integer>(n - 1);
+
+    for (bool central : {false, true}) {
+      for (int nthreads : {1, 2, 4}) {
+        SUB_TEST(std::string(central ? "central" : "forward") +
+                 ", nthreads = " + std::to_string(nthreads));
+        double tol = central ? 1.0e-8 : 1.0e-5;
+        opt::OptionalFDGradient opt;
+        opt.nthreads(nthreads).central(central);
+        opt::FDConstraintJacobian<decltype(&confun)> congrd(
+          confun, ncnln, irowgd, icolgd, opt);
+        // adjacent columns share a row, alternate ones don't
+        ASSERT_EQUAL(congrd.ngroups(), static_cast<size_t>(2));
+        std::vector<double> gdx(irowgd.size(), 0.0);
+        utility::vector_view<double> gdxv(gdx);
+        types::f77_integer inform = 0;
+        congrd(xv, gdxv, inform);
+        ASSERT_EQUAL(inform, 0);
+        for (size_t k = 0; k < gdx.size(); ++k) {
+          ASSERT_TRUE(std::abs(gdx[k] - egdx[k]) <= tol);
+        }
+      }
+    }
+
+    // ... and with a dense row, so that every column is in its own group
+    for (size_t i = 0; i < n; ++i) {
+      irowgd.push_back(static_cast<types::f77_integer>(n));
+      icolgd.push_back(static_cast<types::f77_integer>(i + 1));
+      egdx.push_back(1.0);
+    }
+    ncnln = static_cast<types::f77_integer>(n);
+    {
+      SUB_TEST("dense row");
+      opt::OptionalFDGradient opt;
+      opt.nthreads(3);
+      opt::FDConstraintJacobian<decltype(&confun)> congrd(confun, ncnln,
+                                                          irowgd, icolgd, opt);
+      ASSERT_EQUAL(congrd.ngroups(), n);
+      std::vector<double> gdx(irowgd.size(), 0.0);
+      utility::vector_view<double> gdxv(gdx);
+      types::f77_integer inform = 0;
+      congrd(xv, gdxv, inform);
+      ASSERT_EQUAL(inform, 0);
+      for (size_t k = 0; k < gdx.size(); ++k) {
+        ASSERT_TRUE(std::abs(gdx[k] - egdx[k]) <= 1.0e-5);
+      }
+    }
+    {
+      SUB_TEST("mismatched sparsity arrays");
+      std::vector<types::f77_integer> short_icolgd(icolgd.begin(),
+                                                   icolgd.end() - 1);
+      ASSERT_THROWS(error_handler::ErrorException,
+                    opt::FDConstraintJacobian<decltype(&confun)>(
+                      confun, ncnln, irowgd, short_icolgd));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_fd_constraint_jacobian, "Test FDConstraintJacobian against the analytic Jacobian");
+// clang-format on
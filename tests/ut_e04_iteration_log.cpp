@@ -0,0 +1,101 @@
+// unit test for opt::IterationLog
+#include "e04/nagcpp_e04_iteration_log.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_iteration_log : public TestCase {
+  void run() override {
+    std::vector<double> x = {1.0, 2.0};
+    std::vector<double> u = {0.5};
+    std::vector<double> rinfo(100, 0.0), stats(100, 0.0);
+    utility::vector_view<const double> xv(x), uv(u), rinfov(rinfo),
+      statsv(stats);
+
+    opt::IterationLog log({{"objective", opt::IterationLog::Source::RINFO, 0},
+                           {"iterations", opt::IterationLog::Source::STATS, 0},
+                           {"step", opt::IterationLog::Source::RINFO, 99}},
+                          2);
+    {
+      SUB_TEST("monit adaptors");
+      auto foas_monit = log.foas_monit();
+      auto ipopt_monit = log.ipopt_monit();
+      for (int i = 0; i < 3; ++i) {
+        rinfo[0] = 10.0 - i;
+        stats[0] = i + 1;
+        rinfo[99] = 0.5 * i;
+        if (i % 2) {
+          ipopt_monit(xv, uv, rinfov, statsv);
+        } else {
+          foas_monit(xv, rinfov, statsv);
+        }
+      }
+      ASSERT_EQUAL(log.nrows(), static_cast<size_t>(3));
+      ASSERT_EQUAL(log.ncolumns(), static_cast<size_t>(3));
+      std::vector<double> eobjective = {10.0, 9.0, 8.0};
+      ASSERT_ARRAY_FLOATS_EQUAL(3, log.column("objective"), eobjective);
+      ASSERT_FLOATS_EQUAL(log.column(1)[2], 3.0);
+      ASSERT_FLOATS_EQUAL(log.column("step")[1], 0.5);
+      ASSERT_STRINGS_EQUAL(log.names()[1], "iterations");
+    }
+    {
+      SUB_TEST("csv");
+      std::ostringstream os;
+      log.write_csv(os);
+      ASSERT_STRINGS_EQUAL(os.str(), "objective,iterations,step\n"
+                                     "10,1,0\n"
+                                     "9,2,0.5\n"
+                                     "8,3,1\n");
+    }
+    {
+      SUB_TEST("binary");
+      std::ostringstream os;
+      log.write_binary(os);
+      std::string data = os.str();
+      size_t expected_size = 2 * sizeof(std::uint64_t) +
+                             3 * sizeof(std::uint64_t) + 9 + 10 + 4 +
+                             9 * sizeof(double);
+      ASSERT_EQUAL(data.size(), expected_size);
+      if (last_assert_passed) {
+        std::uint64_t header[2];
+        std::memcpy(header, data.data(), sizeof(header));
+        ASSERT_EQUAL(header[0], static_cast<std::uint64_t>(3));
+        ASSERT_EQUAL(header[1], static_cast<std::uint64_t>(3));
+        double step[3];
+        std::memcpy(step, data.data() + data.size() - 3 * sizeof(double),
+                    sizeof(step));
+        ASSERT_FLOATS_EQUAL(step[2], 1.0);
+      }
+    }
+    {
+      SUB_TEST("clear");
+      log.clear();
+      ASSERT_EQUAL(log.nrows(), static_cast<size_t>(0));
+      ASSERT_EQUAL(log.ncolumns(), static_cast<size_t>(3));
+    }
+    {
+      SUB_TEST("default columns");
+      opt::IterationLog all_log;
+      ASSERT_EQUAL(all_log.ncolumns(), static_cast<size_t>(200));
+      all_log.append(rinfo.data(), stats.data());
+      ASSERT_FLOATS_EQUAL(all_log.column("stats_0")[0], 3.0);
+      ASSERT_FLOATS_EQUAL(all_log.column("rinfo_99")[0], 1.0);
+    }
+    {
+      SUB_TEST("error exits");
+      ASSERT_THROWS(error_handler::ErrorException, log.column("missing"));
+      ASSERT_THROWS(error_handler::ErrorException, log.column(3));
+      ASSERT_THROWS(
+        error_handler::ErrorException,
+        opt::IterationLog({{"bad", opt::IterationLog::Source::STATS, 100}}));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_iteration_log, "Test IterationLog");
+// clang-format on
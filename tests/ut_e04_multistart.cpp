@@ -0,0 +1,143 @@
+// unit test for opt::handle_solve_multistart
+#include "e04/nagcpp_e04_multistart.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  // a solve function that doesn't call a solver: the "solution" is the
+  // starting point and the objective is sum(x^2)
+  void fake_solve(opt::CommE04RA &handle, std::vector<double> &x,
+                  std::vector<double> &rinfo, std::vector<double> &stats,
+                  const opt::MultistartBest &best) {
+    double f = 0.0;
+    for (auto xi : x) {
+      f += xi * xi;
+    }
+    rinfo.assign(100, 0.0);
+    stats.assign(100, 0.0);
+    rinfo[0] = f;
+  }
+}
+
+struct test_multistart_ranking : public TestCase {
+  void run() override {
+    types::f77_integer nvar = 2;
+    std::vector<std::vector<double>> starts = {
+      {3.0, 0.0}, {1.0, 1.0}, {0.0, 0.5}, {2.0, 2.0}, {-1.0, 0.0}, {4.0, 1.0}};
+    std::vector<double> expected_f = {0.25, 1.0, 2.0, 8.0, 9.0, 17.0};
+    std::vector<size_t> expected_start = {2, 4, 1, 3, 0, 5};
+
+    for (int nthreads : {1, 3, 8}) {
+      SUB_TEST("nthreads = " + std::to_string(nthreads));
+      std::atomic<int> nbuild(0);
+      opt::OptionalMultistart opt;
+      opt.nthreads(nthreads);
+      auto results = opt::handle_solve_multistart(
+        nvar, [&](opt::CommE04RA &) { nbuild++; }, fake_solve, starts, opt);
+
+      ASSERT_EQUAL(results.size(), starts.size());
+      // one handle per worker, never more workers than starts
+      ASSERT_EQUAL(nbuild.load(), std::min(nthreads, 6));
+      for (size_t i = 0; i < results.size(); ++i) {
+        ASSERT_EQUAL(results[i].start, expected_start[i]);
+        ASSERT_FLOATS_EQUAL(results[i].objective, expected_f[i]);
+        ASSERT_EQUAL(results[i].errorid, 0);
+        ASSERT_ARRAY_FLOATS_EQUAL(2, results[i].x, starts[expected_start[i]]);
+        ASSERT_EQUAL(results[i].stats.size(), static_cast<size_t>(100));
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_multistart_ranking, "Test handle_solve_multistart ranks the starts");
+// clang-format on
+
+struct test_multistart_errors_and_cutoff : public TestCase {
+  void run() override {
+    types::f77_integer nvar = 1;
+    std::vector<std::vector<double>> starts = {{3.0}, {-1.0}, {2.0}, {5.0}};
+    {
+      SUB_TEST("failed starts are ranked last");
+      opt::OptionalMultistart opt;
+      opt.nthreads(2);
+      auto results = opt::handle_solve_multistart(
+        nvar, [](opt::CommE04RA &) {},
+        [](opt::CommE04RA &handle, std::vector<double> &x,
+           std::vector<double> &rinfo, std::vector<double> &stats,
+           const opt::MultistartBest &best) {
+          if (x[0] < 0.0) {
+            opt::OptionalE04RA fail_opt;
+            fail_opt.fail.prepare("fake_solver");
+            fail_opt.fail.raise_error_comm_invalid("handle");
+          }
+          rinfo.assign(1, x[0]);
+        },
+        starts, opt);
+      ASSERT_EQUAL(results.size(), starts.size());
+      ASSERT_EQUAL(results[0].start, static_cast<size_t>(2));
+      ASSERT_EQUAL(results[3].start, static_cast<size_t>(1));
+      ASSERT_TRUE(std::isnan(results[3].objective));
+      ASSERT_EQUAL(results[3].errorid, error_handler::IERR_COMM_INVALID);
+    }
+    {
+      SUB_TEST("starts that raise a warning are still ranked");
+      opt::OptionalMultistart opt;
+      opt.nthreads(2);
+      auto results = opt::handle_solve_multistart(
+        nvar, [](opt::CommE04RA &) {},
+        [](opt::CommE04RA &handle, std::vector<double> &x,
+           std::vector<double> &rinfo, std::vector<double> &stats,
+           const opt::MultistartBest &best) {
+          rinfo.assign(1, x[0]);
+          if (x[0] < 0.0) {
+            opt::OptionalE04RA warn_opt;
+            warn_opt.fail.error_handler_type =
+              error_handler::ErrorHandlerType::ThrowAll;
+            warn_opt.fail.prepare("fake_solver");
+            warn_opt.fail.set_errorid(50, error_handler::ErrorCategory::Warning,
+                                      error_handler::ErrorType::GeneralWarning);
+            warn_opt.fail.throw_error();
+            warn_opt.fail.throw_warning();
+          }
+        },
+        starts, opt);
+      ASSERT_EQUAL(results.size(), starts.size());
+      ASSERT_EQUAL(results[0].start, static_cast<size_t>(1));
+      ASSERT_FLOATS_EQUAL(results[0].objective, -1.0);
+      ASSERT_EQUAL(results[0].errorid, 50);
+      ASSERT_EQUAL(results[1].errorid, 0);
+    }
+    {
+      SUB_TEST("other exceptions are rethrown");
+      opt::OptionalMultistart opt;
+      opt.nthreads(2);
+      ASSERT_THROWS(
+        std::runtime_error,
+        opt::handle_solve_multistart(
+          nvar, [](opt::CommE04RA &) {},
+          [](opt::CommE04RA &, std::vector<double> &, std::vector<double> &,
+             std::vector<double> &,
+             const opt::MultistartBest &) { throw std::runtime_error("x"); },
+          starts, opt));
+    }
+    {
+      SUB_TEST("cutoff");
+      opt::OptionalMultistart opt;
+      opt.cutoff(4.0);
+      auto results = opt::handle_solve_multistart(
+        nvar, [](opt::CommE04RA &) {}, fake_solve, starts, opt);
+      // the second start reaches the cutoff
+      ASSERT_EQUAL(results.size(), static_cast<size_t>(2));
+      ASSERT_EQUAL(results[0].start, static_cast<size_t>(1));
+      ASSERT_FLOATS_EQUAL(results[0].objective, 1.0);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_multistart_errors_and_cutoff, "Test handle_solve_multistart error handling and cutoff");
+// clang-format on
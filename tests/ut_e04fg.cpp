@@ -0,0 +1,112 @@
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "e04/nagcpp_e04fg.hpp"
+#include "e04/nagcpp_e04rh.hpp"
+#include "e04/nagcpp_e04rm.hpp"
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  void setup_problem(opt::CommE04RA &handle) {
+    types::f77_integer nres = 2;
+    opt::handle_set_nlnls(handle, nres, nullptr, nullptr);
+    handle.DFOTrustRegionTolerance(5.0e-6);
+    handle.PrintLevel(0);
+    std::vector<double> lx = {-1.5, -2.0};
+    std::vector<double> ux = {2.0, 1.0e20};
+    opt::handle_set_simplebounds(handle, lx, ux);
+  }
+  void rosenbrock(const double *x, double *rx) {
+    rx[0] = 1.0 - x[0];
+    rx[1] = 10.0 * (x[1] - x[0] * x[0]);
+  }
+}
+
+struct test_parallel_driver_matches_rcomm : public TestCase {
+  void run() override {
+    types::f77_integer nvar = 2;
+    types::f77_integer nres = 2;
+    types::f77_integer maxeval = 3;
+
+    // reverse communication loop
+    std::vector<double> ex;
+    {
+      opt::CommE04RA handle(nvar);
+      setup_problem(handle);
+      std::vector<double> x(nvar * maxeval, 0.0);
+      std::vector<double> rx(nres * maxeval, 0.0);
+      x[0] = -1.2;
+      x[1] = 1.0;
+      utility::array2D<double, data_handling::ArgIntent::IntentINOUT> ax(
+        x.data(), nvar, maxeval);
+      utility::array2D<double, data_handling::ArgIntent::IntentINOUT> arx(
+        rx.data(), nres, maxeval);
+      std::vector<double> rinfo, stats;
+      types::f77_integer irevcm = 0, neval;
+      do {
+        opt::handle_solve_dfls_rcomm(handle, irevcm, neval, ax, arx, rinfo,
+                                     stats);
+        if (irevcm == 1) {
+          for (types::f77_integer i = 0; i < neval; ++i) {
+            rosenbrock(&x[i * nvar], &rx[i * nres]);
+          }
+        }
+      } while (irevcm != 0);
+      ex.assign(x.begin(), x.begin() + nvar);
+    }
+
+    // forward communication driver
+    {
+      SUB_TEST("multiple threads");
+      opt::CommE04RA handle(nvar);
+      setup_problem(handle);
+      std::vector<double> x = {-1.2, 1.0};
+      std::vector<double> rx, rinfo, stats;
+      std::atomic<int> ncalls(0);
+      opt::OptionalE04FG opt;
+      opt.nthreads(3);
+      opt::handle_solve_dfls_parallel(
+        handle,
+        [&ncalls](const utility::vector_view<const double> &xv,
+                  utility::vector_view<double> &rxv) {
+          ncalls++;
+          rosenbrock(xv.data(), rxv.data());
+        },
+        nres, maxeval, x, rx, rinfo, stats, opt);
+      ASSERT_ARRAY_FLOATS_EQUAL(ex.size(), ex, x);
+      ASSERT_TRUE(ncalls > 0);
+      ASSERT_EQUAL(rx.size(), static_cast<size_t>(nres));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_parallel_driver_matches_rcomm, "Test parallel driver matches the reverse communication loop");
+// clang-format on
+
+struct test_parallel_driver_exception : public TestCase {
+  void run() override {
+    types::f77_integer nvar = 2;
+    opt::CommE04RA handle(nvar);
+    setup_problem(handle);
+    std::vector<double> x = {-1.2, 1.0};
+    std::vector<double> rx, rinfo, stats;
+    opt::OptionalE04FG opt;
+    opt.nthreads(2);
+    ASSERT_THROWS(error_handler::CallbackException,
+                  opt::handle_solve_dfls_parallel(
+                    handle,
+                    [](const utility::vector_view<const double> &,
+                       utility::vector_view<double> &) {
+                      throw std::runtime_error("failed");
+                    },
+                    2, 2, x, rx, rinfo, stats, opt));
+  }
+};
+// clang-format off
+REGISTER_TEST(test_parallel_driver_exception, "Test parallel driver passes on callback exceptions");
+// clang-format on
@@ -0,0 +1,181 @@
+#include "e04/nagcpp_class_CommE04RA.hpp"
+#include "e04/nagcpp_e04kf.hpp"
+#include "e04/nagcpp_e04rg.hpp"
+#include "e04/nagcpp_e04rh.hpp"
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_utility_array.hpp"
+#include <stdexcept>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  // record of the calls made to a fused callback
+  struct FusedCall {
+    double x0;
+    bool need_f;
+    bool need_g;
+  };
+
+  // bound constrained Rosenbrock problem
+  void setup_problem(opt::CommE04RA &handle) {
+    std::vector<types::f77_integer> idxfd = {1, 2};
+    opt::handle_set_nlnobj(handle, idxfd);
+    std::vector<double> lx = {-1.0, -2.0};
+    std::vector<double> ux = {0.8, 2.0};
+    opt::handle_set_simplebounds(handle, lx, ux);
+    handle.PrintLevel(0);
+  }
+  void objfun(const utility::vector_view<const double> &x, double &fx,
+              types::f77_integer &inform) {
+    fx = (1.0 - x[0]) * (1.0 - x[0]) +
+         100.0 * (x[1] - x[0] * x[0]) * (x[1] - x[0] * x[0]);
+  }
+  void objgrd(const utility::vector_view<const double> &x,
+              utility::vector_view<double> &fdx, types::f77_integer &inform) {
+    fdx[0] = 2.0 * x[0] - 400.0 * x[0] * (x[1] - x[0] * x[0]) - 2.0;
+    fdx[1] = 200.0 * (x[1] - x[0] * x[0]);
+  }
+}
+
+struct test_fused_cache : public TestCase {
+  void run() override {
+    std::vector<FusedCall> calls;
+    bool fail = false;
+    bool throw_error = false;
+    auto objfg = [&](const utility::vector_view<const double> &x, double &fx,
+                     utility::vector_view<double> &fdx, const bool need_f,
+                     const bool need_g, types::f77_integer &inform) {
+      calls.push_back({x[0], need_f, need_g});
+      if (throw_error) {
+        throw std::runtime_error("objfg failed");
+      }
+      if (fail) {
+        inform = -1;
+        return;
+      }
+      if (need_f) {
+        fx = x[0] * x[0] + x[1];
+      }
+      if (need_g) {
+        fdx[0] = 2.0 * x[0];
+        fdx[1] = 1.0;
+      }
+    };
+    opt::internal::FusedObjectiveEvaluationCache<decltype(objfg)> cache(objfg);
+
+    std::vector<double> x = {3.0, 1.0};
+    utility::vector_view<const double> xv(x);
+    std::vector<double> fdx(2, 0.0);
+    utility::vector_view<double> fdxv(fdx);
+    double fx = 0.0;
+    types::f77_integer inform = 0;
+    {
+      SUB_TEST("objfun then objgrd at the same point");
+      cache.objfun(xv, fx, inform);
+      cache.objgrd(xv, fdxv, inform);
+      cache.objfun(xv, fx, inform);
+      cache.objgrd(xv, fdxv, inform);
+      ASSERT_FLOATS_EQUAL(fx, 10.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], 6.0);
+      ASSERT_EQUAL(calls.size(), static_cast<size_t>(2));
+      ASSERT_TRUE(calls[0].need_f && !calls[0].need_g);
+      ASSERT_TRUE(!calls[1].need_f && calls[1].need_g);
+    }
+    {
+      SUB_TEST("objgrd at a new point");
+      calls.clear();
+      x[0] = -1.0;
+      cache.objgrd(xv, fdxv, inform);
+      cache.objfun(xv, fx, inform);
+      ASSERT_FLOATS_EQUAL(fx, 2.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], -2.0);
+      ASSERT_EQUAL(calls.size(), static_cast<size_t>(1));
+      ASSERT_TRUE(calls[0].need_f && calls[0].need_g);
+    }
+    {
+      SUB_TEST("failed evaluations are not cached");
+      calls.clear();
+      x[0] = 2.0;
+      fail = true;
+      cache.objfun(xv, fx, inform);
+      ASSERT_EQUAL(inform, -1);
+      fail = false;
+      inform = 0;
+      cache.objgrd(xv, fdxv, inform);
+      ASSERT_EQUAL(inform, 0);
+      ASSERT_FLOATS_EQUAL(fdx[0], 4.0);
+      ASSERT_EQUAL(calls.size(), static_cast<size_t>(2));
+      ASSERT_TRUE(calls[1].need_f && calls[1].need_g);
+    }
+    {
+      SUB_TEST("evaluations that throw are not cached");
+      calls.clear();
+      x[0] = 4.0;
+      throw_error = true;
+      ASSERT_THROWS(std::runtime_error, cache.objfun(xv, fx, inform));
+      throw_error = false;
+      cache.objgrd(xv, fdxv, inform);
+      cache.objfun(xv, fx, inform);
+      ASSERT_FLOATS_EQUAL(fx, 17.0);
+      ASSERT_FLOATS_EQUAL(fdx[0], 8.0);
+      ASSERT_EQUAL(calls.size(), static_cast<size_t>(2));
+      ASSERT_TRUE(calls[1].need_f && calls[1].need_g);
+    }
+    {
+      SUB_TEST("counters");
+      cache.clear();
+      calls.clear();
+      cache.objfun(xv, fx, inform);
+      cache.objgrd(xv, fdxv, inform);
+      cache.objfun(xv, fx, inform);
+      ASSERT_EQUAL(calls.size(), static_cast<size_t>(2));
+      ASSERT_EQUAL(cache.get_nhits(), static_cast<size_t>(1));
+      ASSERT_EQUAL(cache.get_nmisses(), static_cast<size_t>(2));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_fused_cache, "Test the cache used by the fused e04kf callback");
+// clang-format on
+
+struct test_fused_callback_matches_separate : public TestCase {
+  void run() override {
+    types::f77_integer nvar = 2;
+    std::vector<double> ex = {-1.5, 1.9};
+    std::vector<double> erinfo(100), estats(100);
+    {
+      opt::CommE04RA handle(nvar);
+      setup_problem(handle);
+      opt::handle_solve_bounds_foas(handle, objfun, objgrd, nullptr, ex,
+                                    erinfo, estats);
+    }
+
+    int nf = 0, ng = 0;
+    auto objfg = [&](const utility::vector_view<const double> &x, double &fx,
+                     utility::vector_view<double> &fdx, const bool need_f,
+                     const bool need_g, types::f77_integer &inform) {
+      if (need_f) {
+        ++nf;
+        objfun(x, fx, inform);
+      }
+      if (need_g) {
+        ++ng;
+        objgrd(x, fdx, inform);
+      }
+    };
+    std::vector<double> x = {-1.5, 1.9};
+    std::vector<double> rinfo(100), stats(100);
+    opt::CommE04RA handle(nvar);
+    setup_problem(handle);
+    opt::handle_solve_bounds_foas(handle, objfg, nullptr, x, rinfo, stats);
+
+    ASSERT_ARRAY_FLOATS_EQUAL(nvar, x, ex);
+    ASSERT_FLOATS_EQUAL(rinfo[0], erinfo[0]);
+    ASSERT_TRUE(nf > 0);
+    ASSERT_TRUE(ng > 0);
+  }
+};
+// clang-format off
+REGISTER_TEST(test_fused_callback_matches_separate, "Test the fused e04kf callback gives the same solution as separate callbacks");
+// clang-format on
@@ -5,7 +5,9 @@
 #include "utility/nagcpp_engine_types.hpp"
 #include "utility/nagcpp_error_handler.hpp"
 #include <algorithm>
+#include <cstring>
 #include <exception>
+#include <regex>
 #include <sstream>
 #include <stdio.h>
 
@@ -1158,3 +1160,159 @@ struct test_is_error_array_size_3 : public TestCase {
 // clang-format off
 REGISTER_TEST(test_is_error_array_size_3, "Test is_error_array_size_3");
 // clang-format on
+
+struct test_prepare : public TestCase {
+  void run() override {
+    using namespace errbuf_setup;
+    {
+      SUB_TEST("function name");
+      error_handler::ErrorHandler eh;
+      eh.prepare("test1");
+      ASSERT_STRINGS_EQUAL(eh.fun_name, "test1");
+      eh.prepare("test1");
+      ASSERT_STRINGS_EQUAL(eh.fun_name, "test1");
+      eh.prepare(std::string("test2"));
+      ASSERT_STRINGS_EQUAL(eh.fun_name, "test2");
+    }
+    {
+      SUB_TEST("state from a previous failure is cleared");
+      error_handler::ErrorHandler eh;
+      eh.prepare("test1");
+      eh.error_handler_type = error_handler::ErrorHandlerType::ThrowNothing;
+      eh.errorid = 3;
+      generate_errbuf(eh.errbuf, 3, 4, 2, "HELLO", 1.4);
+      types::engine_data en_data;
+      engine_routines::y90haan_(en_data);
+      bool handled = eh.initial_error_handler(en_data);
+      ASSERT_FALSE(handled);
+      eh.set_errorid(3, error_handler::ErrorCategory::Warning,
+                     error_handler::ErrorType::GeneralWarning);
+      eh.append_msg(true, "Value ", 1, ".");
+      eh.throw_error();
+      ASSERT_TRUE(eh.warning_thrown);
+
+      eh.prepare("test1");
+      ASSERT_EQUAL(eh.errorid, error_handler::IERR_SUCCESS);
+      ASSERT_EQUAL(eh.ierr, 0);
+      ASSERT_EQUAL(eh.ifmt, 0);
+      ASSERT_TRUE((eh.type == error_handler::ErrorType::NoError));
+      ASSERT_TRUE((eh.category == error_handler::ErrorCategory::None));
+      ASSERT_FALSE(eh.warning_thrown);
+      ASSERT_FALSE(eh.error_thrown);
+      ASSERT_EQUAL(eh.msg.size(), static_cast<size_t>(0));
+      ASSERT_EQUAL(eh.eb_data.size(), static_cast<size_t>(0));
+      for (types::f77_charlen i = 0;
+           i <= error_handler::ErrorHandler::errbuf_length; ++i) {
+        ASSERT_EQUAL_ONLY_COUNT_FAILURE(eh.errbuf[i], '\0');
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_prepare, "Test prepare");
+// clang-format on
+
+namespace legacy_parser {
+  // original, std::regex based, implementation of populate_eb_data
+  bool populate_eb_data(error_handler::ErrorHandler &eh) {
+    bool internal_error = false;
+    try {
+      std::regex reg(std::string(1, error_handler::errbuf_delim));
+      std::string serrbuf(eh.errbuf);
+      std::sregex_token_iterator iter(serrbuf.begin(), serrbuf.end(), reg, -1);
+      std::sregex_token_iterator end;
+      for (; iter != end && *iter == ""; iter++)
+        ;
+      if (iter != end) {
+        eh.ierr = std::stoi((*iter).str());
+        iter++;
+      }
+      if (iter != end) {
+        eh.ifmt = std::stoi((*iter).str());
+        iter++;
+      }
+      if (iter != end) {
+        int ndata = std::stoi((*iter).str());
+        iter++;
+        if (ndata > 0) {
+          eh.eb_data.assign(iter, end);
+          eh.eb_data.resize(ndata, error_handler::unknown_data_msg);
+        }
+      } else {
+        internal_error = true;
+      }
+    } catch (...) {
+      internal_error = true;
+    }
+    if (internal_error) {
+      eh.set_unexpected_error();
+    }
+    return internal_error;
+  }
+}
+
+struct test_populate_eb_data_against_legacy : public TestCase {
+  void check_errbuf(const std::string &contents) {
+    error_handler::ErrorHandler eh1, eh2;
+    std::memset(eh1.errbuf, '\0', sizeof(eh1.errbuf));
+    std::strncpy(eh1.errbuf, contents.c_str(),
+                 error_handler::ErrorHandler::errbuf_length);
+    std::memcpy(eh2.errbuf, eh1.errbuf, sizeof(eh1.errbuf));
+    bool failed1 = eh1.populate_eb_data();
+    bool failed2 = legacy_parser::populate_eb_data(eh2);
+    ASSERT_EQUAL(failed1, failed2);
+    ASSERT_EQUAL(eh1.ierr, eh2.ierr);
+    ASSERT_EQUAL(eh1.ifmt, eh2.ifmt);
+    ASSERT_STRINGS_EQUAL(eh1.msg, eh2.msg);
+    ASSERT_EQUAL(eh1.eb_data.size(), eh2.eb_data.size());
+    if (eh1.eb_data.size() == eh2.eb_data.size()) {
+      for (size_t i = 0; i < eh1.eb_data.size(); ++i) {
+        ASSERT_STRINGS_EQUAL(eh1.eb_data[i], eh2.eb_data[i]);
+      }
+    }
+  }
+  void run() override {
+    using namespace errbuf_setup;
+    const std::string d(1, error_handler::errbuf_delim);
+    {
+      SUB_TEST("standard message formats");
+      for (int ndata = 0; ndata <= 10; ++ndata) {
+        for (int nsupplied = 0; nsupplied <= 10; ++nsupplied) {
+          std::string contents = "3" + d + "99997" + d +
+                                 std::to_string(ndata) + d;
+          for (int i = 0; i < nsupplied; ++i) {
+            contents += "      " + std::to_string(1.5 * i - 3) + d;
+          }
+          check_errbuf(contents);
+        }
+      }
+      error_handler::ErrorHandler eh;
+      generate_errbuf(eh.errbuf, -999, -999, 0);
+      check_errbuf(eh.errbuf);
+      generate_errbuf(eh.errbuf, 1, 2, 3, "HELLO", 1.4, 5);
+      check_errbuf(eh.errbuf);
+      generate_errbuf(eh.errbuf, 10601, -1111, 2, "x", "a b c");
+      check_errbuf(eh.errbuf);
+    }
+    {
+      SUB_TEST("unusual contents");
+      check_errbuf("");
+      check_errbuf(d + d + d);
+      check_errbuf(d + d + "1" + d + "2" + d + "1" + d + "data");
+      check_errbuf("1" + d + "2");
+      check_errbuf("1" + d + "2" + d + "2" + d + d + "last");
+      check_errbuf("1" + d + "2" + d + "2" + d + "first" + d + d);
+      check_errbuf("  -1" + d + " +2 " + d + "1x" + d + "data");
+      check_errbuf("a" + d + "2" + d + "0");
+      check_errbuf("1" + d + "b" + d + "0");
+      check_errbuf("1" + d + "2" + d + "c");
+      check_errbuf("1" + d + "2" + d + "-3" + d + "data");
+      check_errbuf("99999999999" + d + "2" + d + "0");
+      check_errbuf("2147483647" + d + "-2147483648" + d + "0");
+      check_errbuf("1" + d + "2" + d + "1" + d + std::string(250, 'z'));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_populate_eb_data_against_legacy, "Test populate_eb_data against the original regex based parser");
+// clang-format on
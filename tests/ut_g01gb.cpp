@@ -0,0 +1,63 @@
+#include "g01/nagcpp_g01gb.hpp"
+#include "include/cxxunit_testing.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_batched_matches_scalar : public TestCase {
+  void run() override {
+    std::vector<double> t = {-1.528, -0.188, 1.138, 2.5};
+    std::vector<double> df = {20.0, 7.5, 45.0, 12.0};
+    std::vector<double> delta = {2.0, 1.0, 0.0, -0.5};
+    std::vector<double> ep(t.size());
+    for (size_t i = 0; i < t.size(); ++i) {
+      ep[i] = stat::prob_students_t_noncentral(t[i], df[i], delta[i]);
+    }
+    {
+      SUB_TEST("single thread");
+      std::vector<double> p;
+      std::vector<types::f77_integer> ivalid;
+      stat::prob_students_t_noncentral(t, df, delta, p, ivalid);
+      std::vector<types::f77_integer> eivalid(t.size(), 0);
+      ASSERT_ARRAY_FLOATS_EQUAL(ep.size(), ep, p);
+      ASSERT_ARRAY_EQUAL(eivalid.size(), eivalid, ivalid);
+    }
+    {
+      SUB_TEST("multiple threads");
+      std::vector<double> p;
+      std::vector<types::f77_integer> ivalid;
+      stat::OptionalG01GB opt;
+      opt.nthreads(3);
+      stat::prob_students_t_noncentral(t, df, delta, p, ivalid, opt);
+      ASSERT_ARRAY_FLOATS_EQUAL(ep.size(), ep, p);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_batched_matches_scalar, "Test batched interface matches scalar interface");
+// clang-format on
+
+struct test_batched_cyclic_and_status : public TestCase {
+  void run() override {
+    std::vector<double> t = {-1.0, 0.0, 1.0};
+    std::vector<double> df = {0.5, 10.0, 10.0};
+    std::vector<double> delta = {1.0};
+    std::vector<double> p;
+    std::vector<types::f77_integer> ivalid;
+    stat::OptionalG01GB opt;
+    stat::prob_students_t_noncentral(t, df, delta, p, ivalid, opt);
+    ASSERT_EQUAL(p.size(), static_cast<size_t>(3));
+    ASSERT_EQUAL(ivalid[0], 1);
+    ASSERT_TRUE(std::isnan(p[0]));
+    ASSERT_EQUAL(ivalid[1], 0);
+    ASSERT_EQUAL(ivalid[2], 0);
+    double ep = stat::prob_students_t_noncentral(t[2], df[2], delta[0]);
+    ASSERT_FLOATS_EQUAL(ep, p[2]);
+    ASSERT_EQUAL(opt.fail.errorid, 1);
+    ASSERT_TRUE(opt.fail.warning_thrown);
+  }
+};
+// clang-format off
+REGISTER_TEST(test_batched_cyclic_and_status, "Test batched interface with cyclic inputs and invalid elements");
+// clang-format on
@@ -2,9 +2,13 @@
 // see also ut_iomanager_through_engine.cpp
 #include "include/cxxunit_testing.hpp"
 #include "utility/nagcpp_iomanager.hpp"
+#include "utility/nagcpp_utility_optional.hpp"
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 // XXX CURRENTLY THIS DOES NOT TEST THE ADVISORY / ERROR UNITS:
 //   register_to_advisory_message_unit
@@ -429,3 +433,101 @@ struct test_lots_of_istreams : public TestCase {
 // clang-format off
 REGISTER_TEST(test_lots_of_istreams, "Test the class can cleanly handle lots of istreams");
 // clang-format on
+
+struct test_default_iomanager : public TestCase {
+  void run() override {
+    {
+      SUB_TEST("GLOBAL_IOMANAGER is the default");
+      utility::Optional opt;
+      ASSERT_TRUE(opt.iomanager == iomanager::GLOBAL_IOMANAGER);
+    }
+    {
+      SUB_TEST("scoped default for the calling thread");
+      std::shared_ptr<iomanager::IOManager> io =
+        iomanager::IOManager::thread_local_instance();
+      ASSERT_TRUE(io == iomanager::IOManager::thread_local_instance());
+      {
+        iomanager::ScopedDefaultIOManager scope(io);
+        utility::Optional opt;
+        ASSERT_TRUE(opt.iomanager == io);
+      }
+      utility::Optional opt;
+      ASSERT_TRUE(opt.iomanager == iomanager::GLOBAL_IOMANAGER);
+    }
+    {
+      SUB_TEST("each thread has its own instance");
+      int nthreads = 4;
+      std::vector<std::shared_ptr<iomanager::IOManagerBase>> used(nthreads);
+      std::vector<std::string> output(nthreads);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&used, &output, t] {
+          iomanager::ScopedDefaultIOManager scope(
+            iomanager::IOManager::thread_local_instance());
+          utility::Optional opt;
+          used[t] = opt.iomanager;
+          std::stringstream this_stream;
+          types::f77_integer nout =
+            opt.iomanager->register_ostream(this_stream);
+          for (int i = 0; i < 100; ++i) {
+            opt.iomanager->print_rec(nout, std::to_string(t));
+          }
+          opt.iomanager->deregister_ostream(this_stream);
+          output[t] = this_stream.str();
+        });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      for (int t = 0; t < nthreads; ++t) {
+        ASSERT_TRUE(used[t] != iomanager::GLOBAL_IOMANAGER);
+        for (int s = 0; s < t; ++s) {
+          ASSERT_TRUE(used[t] != used[s]);
+        }
+        std::string expected;
+        for (int i = 0; i < 100; ++i) {
+          expected += std::to_string(t) + "\n";
+        }
+        ASSERT_STRINGS_EQUAL(output[t], expected);
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_default_iomanager, "Test the per thread default IOManager");
+// clang-format on
+
+struct test_concurrent_registration : public TestCase {
+  void run() override {
+    // streams registered with, and used via, a shared IOManager from
+    // several threads at once
+    iomanager::IOManager io;
+    int nthreads = 4;
+    int nstreams = 8;
+    std::vector<int> nfailed(nthreads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; ++t) {
+      threads.emplace_back([&io, &nfailed, nstreams, t] {
+        for (int k = 0; k < nstreams; ++k) {
+          std::stringstream this_stream;
+          types::f77_integer nout = io.register_ostream(this_stream);
+          io.print_rec(nout, "record");
+          if (io.unit_from_ostream(this_stream) != nout ||
+              this_stream.str() != "record\n") {
+            ++nfailed[t];
+          }
+          io.deregister_ostream(nout);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    for (int t = 0; t < nthreads; ++t) {
+      ASSERT_EQUAL(nfailed[t], 0);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_concurrent_registration, "Test a shared IOManager can be used from several threads");
+// clang-format on
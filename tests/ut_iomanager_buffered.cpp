@@ -0,0 +1,161 @@
+// unit tests for iomanager::BufferedIOManager
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_iomanager_buffered.hpp"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nagcpp;
+
+namespace {
+  // string buffer that can be read while another thread is writing to it
+  class LockedStringBuf : public std::streambuf {
+  private:
+    std::mutex mtx;
+    std::string text;
+
+  protected:
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+      std::lock_guard<std::mutex> lock(mtx);
+      text.append(s, static_cast<size_t>(n));
+      return n;
+    }
+    int_type overflow(int_type ch) override {
+      if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        std::lock_guard<std::mutex> lock(mtx);
+        text.push_back(traits_type::to_char_type(ch));
+      }
+      return ch;
+    }
+
+  public:
+    std::string str(void) {
+      std::lock_guard<std::mutex> lock(mtx);
+      return text;
+    }
+  };
+}
+
+struct test_buffered_manual : public TestCase {
+  void run() override {
+    std::stringstream stream1, stream2;
+    iomanager::BufferedIOManager io;
+    types::f77_integer nout1 = io.register_ostream(stream1);
+    types::f77_integer nout2 = io.register_ostream(stream2);
+    {
+      SUB_TEST("records are held until flush");
+      io.print_rec(nout1, "line 1");
+      io.print_rec_chars(nout2, "line A and more", 6);
+      io.print_rec(nout1, "line 2");
+      ASSERT_STRINGS_EQUAL(stream1.str(), "");
+      io.flush();
+      ASSERT_STRINGS_EQUAL(stream1.str(), "line 1\nline 2\n");
+      ASSERT_STRINGS_EQUAL(stream2.str(), "line A\n");
+    }
+    {
+      SUB_TEST("via a pointer to the base class");
+      std::shared_ptr<iomanager::IOManagerBase> base =
+        std::make_shared<iomanager::BufferedIOManager>();
+      std::stringstream stream3;
+      types::f77_integer nout3 = base->register_ostream(stream3);
+      base->print_rec_chars(nout3, "record", 6);
+      ASSERT_STRINGS_EQUAL(stream3.str(), "");
+      base->flush();
+      ASSERT_STRINGS_EQUAL(stream3.str(), "record\n");
+    }
+    {
+      SUB_TEST("deregistering a stream writes its records");
+      io.print_rec(nout2, "line B");
+      io.deregister_ostream(stream2);
+      ASSERT_STRINGS_EQUAL(stream2.str(), "line A\nline B\n");
+      ASSERT_THROWS(std::ios_base::failure, io.print_rec(nout2, "line C"));
+    }
+    {
+      SUB_TEST("unregistered unit");
+      ASSERT_THROWS(std::ios_base::failure, io.print_rec(999, "line"));
+      io.flush();
+      ASSERT_STRINGS_EQUAL(stream1.str(), "line 1\nline 2\n");
+    }
+    {
+      SUB_TEST("full buffer");
+      std::stringstream stream4;
+      iomanager::BufferedIOManager small_io(
+        iomanager::BufferedIOManager::FlushPolicy::Manual, 16);
+      types::f77_integer nout4 = small_io.register_ostream(stream4);
+      small_io.print_rec(nout4, "0123456");
+      ASSERT_STRINGS_EQUAL(stream4.str(), "");
+      small_io.print_rec(nout4, "789abcd");
+      ASSERT_STRINGS_EQUAL(stream4.str(), "0123456\n789abcd\n");
+    }
+    {
+      SUB_TEST("destruction writes the records");
+      std::stringstream stream5;
+      {
+        iomanager::BufferedIOManager local_io;
+        local_io.print_rec(local_io.register_ostream(stream5), "last");
+      }
+      ASSERT_STRINGS_EQUAL(stream5.str(), "last\n");
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_buffered_manual, "Test BufferedIOManager with a manual flush");
+// clang-format on
+
+struct test_buffered_background : public TestCase {
+  void run() override {
+    LockedStringBuf buf;
+    std::ostream stream(&buf);
+    iomanager::BufferedIOManager io(
+      iomanager::BufferedIOManager::FlushPolicy::Background, 65536,
+      std::chrono::milliseconds(5));
+    types::f77_integer nout = io.register_ostream(stream);
+    {
+      SUB_TEST("writer thread");
+      io.print_rec(nout, "from the writer");
+      std::string text;
+      for (int i = 0; i < 1000 && text.empty(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        text = buf.str();
+      }
+      ASSERT_STRINGS_EQUAL(text, "from the writer\n");
+    }
+    {
+      SUB_TEST("several threads");
+      int nthreads = 4;
+      int nrecs = 500;
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&io, nout, nrecs, t] {
+          std::string rec = "thread " + std::to_string(t);
+          for (int i = 0; i < nrecs; ++i) {
+            io.print_rec(nout, rec);
+          }
+        });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      io.flush();
+      // every record is written whole
+      std::istringstream lines(buf.str());
+      std::string line;
+      std::vector<int> counts(nthreads, 0);
+      std::getline(lines, line);
+      while (std::getline(lines, line)) {
+        ++counts[line.back() - '0'];
+        ASSERT_STRINGS_EQUAL(line.substr(0, 7), "thread ");
+      }
+      for (int t = 0; t < nthreads; ++t) {
+        ASSERT_EQUAL(counts[t], nrecs);
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_buffered_background, "Test BufferedIOManager with a background writer");
+// clang-format on
@@ -0,0 +1,132 @@
+// unit test for code in nagcpp_utility_allocator
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_data_handling.hpp"
+#include "utility/nagcpp_utility_allocator.hpp"
+#include "utility/nagcpp_utility_comm.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_arena_allocator : public TestCase {
+  void run() override {
+    utility::ArenaAllocator arena(256);
+    {
+      SUB_TEST("alignment");
+      arena.allocate(1, 1);
+      void *p = arena.allocate(3 * sizeof(double), alignof(double));
+      ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(p) % alignof(double),
+                   static_cast<std::uintptr_t>(0));
+    }
+    {
+      SUB_TEST("requests larger than the block size");
+      void *p = arena.allocate(1000, 8);
+      ASSERT_TRUE(p != nullptr);
+      ASSERT_TRUE(arena.capacity() >= static_cast<size_t>(1000));
+    }
+    {
+      SUB_TEST("memory is reused after a reset");
+      arena.reset();
+      size_t capacity = arena.capacity();
+      for (int i = 0; i < 100; ++i) {
+        utility::ScopedArenaReset reset(arena);
+        arena.allocate(100, 8);
+        arena.allocate(500, 8);
+      }
+      ASSERT_EQUAL(arena.capacity(), capacity);
+    }
+    {
+      SUB_TEST("rewind");
+      arena.reset();
+      auto m = arena.mark();
+      void *p1 = arena.allocate(16, 8);
+      arena.rewind(m);
+      void *p2 = arena.allocate(16, 8);
+      ASSERT_TRUE(p1 == p2);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_arena_allocator, "Test ArenaAllocator");
+// clang-format on
+
+struct test_workspace_allocator_scope : public TestCase {
+  void run() override {
+    std::shared_ptr<utility::ArenaAllocator> arena =
+      std::make_shared<utility::ArenaAllocator>(4096);
+    {
+      SUB_TEST("default allocator");
+      ASSERT_TRUE(utility::current_workspace_allocator() == nullptr);
+    }
+    {
+      SUB_TEST("scoped allocator");
+      utility::ScopedWorkspaceAllocator scope(arena.get());
+      ASSERT_TRUE(utility::current_workspace_allocator() == arena.get());
+      {
+        utility::ScopedWorkspaceAllocator inner_scope(nullptr);
+        ASSERT_TRUE(utility::current_workspace_allocator() == nullptr);
+      }
+      ASSERT_TRUE(utility::current_workspace_allocator() == arena.get());
+    }
+    ASSERT_TRUE(utility::current_workspace_allocator() == nullptr);
+    {
+      SUB_TEST("RawData local arrays use the arena");
+      utility::ScopedArenaReset reset(*arena);
+      utility::ScopedWorkspaceAllocator scope(arena.get());
+      auto m = arena->mark();
+      {
+        data_handling::RawData<double, data_handling::ArgIntent::IntentOUT>
+          local_x(10);
+        ASSERT_TRUE(local_x.data != nullptr);
+        local_x(9) = 1.0;
+        data_handling::StringRawData<data_handling::ArgIntent::IntentIN>
+          local_name("some_name");
+      }
+      auto m2 = arena->mark();
+      ASSERT_TRUE(m2.block != m.block || m2.offset > m.offset);
+      ASSERT_EQUAL(arena->capacity(), static_cast<size_t>(4096));
+    }
+    {
+      SUB_TEST("the scope rewinds an arena");
+      auto m = arena->mark();
+      for (int i = 0; i < 1000; ++i) {
+        utility::ScopedWorkspaceAllocator scope(arena.get());
+        data_handling::RawData<double, data_handling::ArgIntent::IntentOUT>
+          local_x(100);
+        local_x(99) = 1.0;
+      }
+      auto m2 = arena->mark();
+      ASSERT_TRUE(m2.block == m.block && m2.offset == m.offset);
+      ASSERT_EQUAL(arena->capacity(), static_cast<size_t>(4096));
+    }
+    {
+      SUB_TEST("CopyableComm arrays do not use the arena");
+      // the arrays outlive the wrapper call, so must survive a reset
+      utility::CopyableComm comm;
+      auto m = arena->mark();
+      {
+        utility::ScopedArenaReset reset(*arena);
+        utility::ScopedWorkspaceAllocator scope(arena.get());
+        comm.allocate(10, 5, 0, 0, 2);
+        auto m2 = arena->mark();
+        ASSERT_TRUE(m2.block == m.block && m2.offset == m.offset);
+        comm.rcomm[9] = 1.0;
+      }
+      {
+        utility::ScopedWorkspaceAllocator scope(arena.get());
+        data_handling::RawData<double, data_handling::ArgIntent::IntentOUT>
+          local_x(10);
+        for (size_t i = 0; i < 10; ++i) {
+          local_x(i) = -1.0;
+        }
+      }
+      ASSERT_TRUE(comm.rcomm != nullptr);
+      ASSERT_EQUAL(comm.rcomm[9], 1.0);
+      comm.deallocate();
+      ASSERT_TRUE(comm.rcomm == nullptr);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_workspace_allocator_scope, "Test selecting the allocator used for local arrays");
+// clang-format on
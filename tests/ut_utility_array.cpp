@@ -449,3 +449,36 @@ struct test_array3D_element_get_const : public TestCase {
 // clang-format off
 REGISTER_TEST(test_array3D_element_get_const, "Test array3D () operator overload (const)");
 // clang-format on
+
+struct test_vector_view_element_get_set : public TestCase {
+  void run() override {
+    std::vector<int> dx = {1, 2, 3, 4};
+    utility::vector_view<int> v(dx);
+    ASSERT_TRUE(v.data() == dx.data());
+    ASSERT_EQUAL(v.size(), dx.size());
+    ASSERT_EQUAL(v.size1(), 4);
+    ASSERT_EQUAL(v.ndims(), 1);
+
+    // change v, and check the change is seen in dx
+    v(2) = 15;
+    v[3] = 20;
+    ASSERT_EQUAL(dx[2], 15);
+    ASSERT_EQUAL(dx[3], 20);
+
+    // const view onto the same data
+    utility::vector_view<const int> cv = v;
+    int total = 0;
+    for (const auto &vi : cv) {
+      total += vi;
+    }
+    ASSERT_EQUAL(total, 38);
+    ASSERT_EQUAL(cv.front(), 1);
+    ASSERT_EQUAL(cv.back(), 20);
+
+    utility::vector_view<double> ev;
+    ASSERT_TRUE(ev.empty());
+  }
+};
+// clang-format off
+REGISTER_TEST(test_vector_view_element_get_set, "Test vector_view element access");
+// clang-format on
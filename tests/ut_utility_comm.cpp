@@ -1,7 +1,10 @@
 // unit test for code in nagcpp_utility_comm
 #include "include/cxxunit_testing.hpp"
 #include "utility/nagcpp_utility_comm.hpp"
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace nagcpp;
 
@@ -173,3 +176,140 @@ struct test_copyable : public TestCase {
 // clang-format off
 REGISTER_TEST(test_copyable, "Test copyable");
 // clang-format on
+
+struct test_copyable_move : public TestCase {
+  void run() override {
+    {
+      SUB_TEST("move constructor");
+      utility::CopyableComm a1;
+      a1.allocate(5, 4, 3, 2, 1);
+      a1.rcomm[4] = 2.0;
+      a1.zcomm[1] = 3.0;
+      a1.initialized = true;
+      double *rcomm = a1.rcomm;
+      utility::CopyableComm a2(std::move(a1));
+      ASSERT_TRUE(a2.rcomm == rcomm);
+      ASSERT_EQUAL(a2.lrcomm, 5);
+      ASSERT_EQUAL(a2.lzcomm, 1);
+      ASSERT_EQUAL(a2.zcomm[1], 3.0);
+      ASSERT_TRUE(a2.initialized);
+      ASSERT_TRUE(a1.rcomm == nullptr);
+      ASSERT_EQUAL(a1.lrcomm, 0);
+      ASSERT_FALSE(a1.initialized);
+    }
+    {
+      SUB_TEST("move assignment");
+      utility::CopyableComm a1;
+      a1.allocate(5, 4);
+      a1.icomm[3] = 6;
+      utility::CopyableComm a2;
+      a2.allocate(15, 14);
+      types::f77_integer *icomm = a1.icomm;
+      a2 = std::move(a1);
+      ASSERT_TRUE(a2.icomm == icomm);
+      ASSERT_EQUAL(a2.licomm, 4);
+      ASSERT_EQUAL(a2.icomm[3], 6);
+      ASSERT_TRUE(a1.icomm == nullptr);
+    }
+    {
+      SUB_TEST("copy keeps the state");
+      utility::CopyableComm a1;
+      a1.allocate(3, 2, 0, 0, 2, 1, 1);
+      a1.zcomm[3] = 4.0;
+      a1.rcomm2[0] = 5.0;
+      a1.icomm2[0] = 7;
+      a1.initialized = true;
+      utility::CopyableComm a2(a1);
+      ASSERT_TRUE(a2.initialized);
+      ASSERT_TRUE(a2.zcomm != a1.zcomm);
+      ASSERT_EQUAL(a2.zcomm[3], 4.0);
+      ASSERT_EQUAL(a2.rcomm2[0], 5.0);
+      ASSERT_EQUAL(a2.icomm2[0], 7);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_copyable_move, "Test moving a copyable comm");
+// clang-format on
+
+struct test_copyable_snapshot : public TestCase {
+  void run() override {
+    {
+      SUB_TEST("snapshot shares the arrays");
+      utility::CopyableComm a1;
+      a1.allocate(5, 4);
+      a1.rcomm[0] = 1.0;
+      a1.initialized = true;
+      utility::CopyableComm a2 = a1.snapshot();
+      ASSERT_TRUE(a2.rcomm == a1.rcomm);
+      ASSERT_TRUE(a2.initialized);
+      ASSERT_TRUE(a1.is_shared());
+      ASSERT_TRUE(a2.is_shared());
+    }
+    {
+      SUB_TEST("ensure_unique separates the arrays");
+      utility::CopyableComm a1;
+      a1.allocate(5, 4);
+      a1.rcomm[0] = 1.0;
+      utility::CopyableComm a2 = a1.snapshot();
+      a2.ensure_unique();
+      ASSERT_TRUE(a2.rcomm != a1.rcomm);
+      ASSERT_FALSE(a2.is_shared());
+      ASSERT_FALSE(a1.is_shared());
+      a2.rcomm[0] = 2.0;
+      ASSERT_EQUAL(a1.rcomm[0], 1.0);
+      ASSERT_EQUAL(a2.rcomm[0], 2.0);
+      // a1 is now the only user of the original arrays
+      double *rcomm = a1.rcomm;
+      a1.ensure_unique();
+      ASSERT_TRUE(a1.rcomm == rcomm);
+    }
+    {
+      SUB_TEST("ensure_unique keeps the handle");
+      int h = 0;
+      utility::CopyableComm a1;
+      a1.allocate(5);
+      a1.handle = &h;
+      utility::CopyableComm a2 = a1.snapshot();
+      a1.ensure_unique();
+      ASSERT_TRUE(a1.rcomm != a2.rcomm);
+      ASSERT_TRUE(a1.handle == &h);
+    }
+    {
+      SUB_TEST("concurrent snapshots");
+      utility::CopyableComm a1;
+      a1.allocate(5);
+      a1.rcomm[0] = 4.0;
+      std::vector<utility::CopyableComm> snapshots(4);
+      std::vector<std::thread> threads;
+      for (size_t t = 0; t < snapshots.size(); ++t) {
+        threads.emplace_back([&, t] { snapshots[t] = a1.snapshot(); });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      for (const auto &a2 : snapshots) {
+        ASSERT_TRUE(a2.rcomm == a1.rcomm);
+      }
+      ASSERT_TRUE(a1.is_shared());
+    }
+    {
+      SUB_TEST("arrays outlive the original");
+      utility::CopyableComm a2;
+      {
+        utility::CopyableComm a1;
+        a1.allocate(5);
+        a1.rcomm[4] = 3.0;
+        a2 = a1.snapshot();
+      }
+      ASSERT_FALSE(a2.is_shared());
+      ASSERT_EQUAL(a2.lrcomm, 5);
+      ASSERT_EQUAL(a2.rcomm[4], 3.0);
+      a2.deallocate();
+      ASSERT_TRUE(a2.rcomm == nullptr);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_copyable_snapshot, "Test copy-on-write snapshots of a copyable comm");
+// clang-format on
@@ -1,5 +1,8 @@
 #include "include/cxxunit_testing.hpp"
 #include "utility/nagcpp_utility_functions.hpp"
+#include <clocale>
+#include <cstdlib>
+#include <locale>
 #include <string>
 
 struct test_str_toupper : public TestCase {
@@ -91,6 +94,14 @@ struct test_rname_eq : public TestCase {
 REGISTER_TEST(test_rname_eq, "Test rname_eq");
 // clang-format on
 
+namespace {
+  // numeric punctuation using a ',' as the decimal point
+  struct comma_numpunct : public std::numpunct<char> {
+  protected:
+    char do_decimal_point() const override { return ','; }
+  };
+}
+
 struct test_set_optstr : public TestCase {
   void run() override {
     {
@@ -121,6 +132,37 @@ struct test_set_optstr : public TestCase {
       ASSERT_STRINGS_EQUAL(f3, "GOODBYE = 88");
       ASSERT_STRINGS_EQUAL(f4, "GOODBYE = SOMX STRING");
     }
+    {
+      SUB_TEST("real values are not rounded");
+      std::string f1 = nagcpp::utility::set_optstr("TOL", 0.123456789);
+      ASSERT_STRINGS_EQUAL(f1, "TOL = 0.123456789");
+      std::string f2 = nagcpp::utility::set_optstr("TOL", 0.1);
+      ASSERT_STRINGS_EQUAL(f2, "TOL = 0.1");
+      double x = 1.0 / 3.0;
+      std::string f3 = nagcpp::utility::set_optstr("TOL", x);
+      ASSERT_TRUE(std::strtod(f3.c_str() + 6, nullptr) == x);
+      std::string f4 = nagcpp::utility::set_optstr("TOL", 1.0e20);
+      ASSERT_STRINGS_EQUAL(f4, "TOL = 1e+20");
+    }
+    {
+      SUB_TEST("real values do not depend on the locale");
+      // a global C++ locale with a ',' decimal point ...
+      std::locale old_locale =
+        std::locale::global(std::locale(std::locale(), new comma_numpunct));
+      std::string f1 = nagcpp::utility::set_optstr("TOL", 0.5);
+      std::locale::global(old_locale);
+      ASSERT_STRINGS_EQUAL(f1, "TOL = 0.5");
+      // ... and a C locale with a ',' decimal point (if one is installed)
+      std::string old_c_locale = std::setlocale(LC_NUMERIC, nullptr);
+      for (const char *name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR"}) {
+        if (std::setlocale(LC_NUMERIC, name)) {
+          std::string f2 = nagcpp::utility::set_optstr("TOL", 0.123456789);
+          std::setlocale(LC_NUMERIC, old_c_locale.c_str());
+          ASSERT_STRINGS_EQUAL(f2, "TOL = 0.123456789");
+          break;
+        }
+      }
+    }
   }
 };
 // clang-format off
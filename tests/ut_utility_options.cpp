@@ -0,0 +1,57 @@
+// unit test for code in nagcpp_utility_options
+#include "e04/nagcpp_e04_options.hpp"
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_utility_options.hpp"
+#include <string>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_option_descriptors : public TestCase {
+  void run() override {
+    namespace zm = opt::e04zm_options;
+    namespace ue = opt::e04ue_options;
+    {
+      SUB_TEST("option strings");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(zm::PrintLevel, 1),
+                           "Print Level = 1");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(zm::FOASStopTolerance, 1.5e-7),
+                           "FOAS Stop Tolerance = 1.5e-07");
+      // integer values can be supplied for real options
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(zm::FOASStopTolerance, 1),
+                           "FOAS Stop Tolerance = 1");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(zm::PrintSolution, "YES"),
+                           "Print Solution = YES");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(zm::Defaults), "Defaults");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(ue::ColdStart), "Cold Start");
+      ASSERT_STRINGS_EQUAL(utility::set_optstr(ue::MajorPrintLevel, 0),
+                           "Major Print Level = 0");
+    }
+    {
+      SUB_TEST("option settings");
+      std::vector<utility::OptionSetting<opt::CommE04RA>> settings = {
+        {zm::PrintLevel, 3}, {zm::Defaults}, {zm::PrintSolution, "NO"}};
+      ASSERT_EQUAL(settings.size(), static_cast<size_t>(3));
+      ASSERT_STRINGS_EQUAL(settings[0].str(), "Print Level = 3");
+      ASSERT_STRINGS_EQUAL(settings[1].str(), "Defaults");
+      ASSERT_STRINGS_EQUAL(settings[2].str(), "Print Solution = NO");
+    }
+    {
+      SUB_TEST("value types");
+      ASSERT_TRUE((utility::is_valid_option_value<double, int>::value));
+      ASSERT_TRUE((utility::is_valid_option_value<double, float>::value));
+      ASSERT_FALSE(
+        (utility::is_valid_option_value<types::f77_integer, double>::value));
+      ASSERT_FALSE((utility::is_valid_option_value<double, bool>::value));
+      ASSERT_FALSE(
+        (utility::is_valid_option_value<std::string, double>::value));
+      ASSERT_TRUE(
+        (utility::is_valid_option_value<std::string, const char *>::value));
+      ASSERT_FALSE((utility::is_valid_option_value<types::f77_integer,
+                                                   std::string>::value));
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_option_descriptors, "Test option descriptors");
+// clang-format on
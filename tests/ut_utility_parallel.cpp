@@ -0,0 +1,115 @@
+// unit test for utility::parallel_for and utility::ThreadPool
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_utility_parallel.hpp"
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace nagcpp;
+
+struct test_parallel_for : public TestCase {
+  void run() override {
+    for (int nthreads : {1, 3, 8}) {
+      SUB_TEST("nthreads = " + std::to_string(nthreads));
+      std::vector<int> visited(5, 0);
+      size_t nchunks = utility::parallel_for(
+        visited.size(), nthreads, [&](size_t begin, size_t end, size_t) {
+          for (size_t i = begin; i < end; ++i) {
+            ++visited[i];
+          }
+        });
+      ASSERT_EQUAL(nchunks, std::min(static_cast<size_t>(nthreads),
+                                     visited.size()));
+      for (auto v : visited) {
+        ASSERT_EQUAL(v, 1);
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_parallel_for, "Test parallel_for");
+// clang-format on
+
+struct test_thread_pool : public TestCase {
+  void run() override {
+    utility::ThreadPool pool(4);
+    ASSERT_EQUAL(pool.size(), static_cast<size_t>(4));
+    {
+      SUB_TEST("threads are reused between calls");
+      std::mutex mtx;
+      std::set<std::thread::id> ids;
+      std::vector<int> visited(100, 0);
+      for (int call = 0; call < 50; ++call) {
+        size_t nchunks = pool.parallel_for(
+          visited.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+              ++visited[i];
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            ids.insert(std::this_thread::get_id());
+          });
+        ASSERT_EQUAL(nchunks, static_cast<size_t>(4));
+      }
+      for (auto v : visited) {
+        ASSERT_EQUAL(v, 50);
+      }
+      ASSERT_TRUE(ids.size() <= static_cast<size_t>(4));
+    }
+    {
+      SUB_TEST("fewer items than threads");
+      std::vector<int> visited(2, 0);
+      size_t nchunks = pool.parallel_for(
+        visited.size(), [&](size_t begin, size_t end, size_t) {
+          for (size_t i = begin; i < end; ++i) {
+            ++visited[i];
+          }
+        });
+      ASSERT_EQUAL(nchunks, static_cast<size_t>(2));
+      ASSERT_EQUAL(visited[0], 1);
+      ASSERT_EQUAL(visited[1], 1);
+      ASSERT_EQUAL(pool.parallel_for(0, [](size_t, size_t, size_t) {}),
+                   static_cast<size_t>(0));
+    }
+    {
+      SUB_TEST("exceptions are rethrown");
+      ASSERT_THROWS(std::runtime_error,
+                    pool.parallel_for(8, [](size_t, size_t, size_t ichunk) {
+                      if (ichunk == 2) {
+                        throw std::runtime_error("chunk failed");
+                      }
+                    }));
+      // the pool is still usable
+      std::vector<int> visited(8, 0);
+      pool.parallel_for(visited.size(), [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+          ++visited[i];
+        }
+      });
+      for (auto v : visited) {
+        ASSERT_EQUAL(v, 1);
+      }
+    }
+    {
+      SUB_TEST("nested calls");
+      std::vector<int> visited(16, 0);
+      pool.parallel_for(4, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+          // the pool is busy, so this runs on additional threads
+          pool.parallel_for(4, [&](size_t b, size_t e, size_t) {
+            for (size_t j = b; j < e; ++j) {
+              ++visited[4 * i + j];
+            }
+          });
+        }
+      });
+      for (auto v : visited) {
+        ASSERT_EQUAL(v, 1);
+      }
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_thread_pool, "Test ThreadPool");
+// clang-format on
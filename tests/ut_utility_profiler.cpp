@@ -0,0 +1,68 @@
+// unit test for utility::CallbackProfiler
+#include "include/cxxunit_testing.hpp"
+#include "utility/nagcpp_utility_optional.hpp"
+#include "utility/nagcpp_utility_profiler.hpp"
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace nagcpp;
+
+struct test_callback_profiler : public TestCase {
+  void run() override {
+    utility::CallbackProfiler profiler;
+    {
+      SUB_TEST("call counts and times");
+      {
+        utility::CallbackProfiler::SolveTimer solve_timer(&profiler,
+                                                          {"objfun", "objgrd"});
+        for (int i = 0; i < 3; ++i) {
+          utility::CallbackProfiler::CallTimer timer(&profiler, 0);
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        {
+          utility::CallbackProfiler::CallTimer timer(&profiler, 1);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      const utility::CallbackProfile &profile = profiler.get_profile();
+      ASSERT_EQUAL(profile.callbacks.size(), static_cast<size_t>(2));
+      const utility::CallbackTiming *objfun = profile.get("objfun");
+      ASSERT_TRUE(objfun != nullptr);
+      ASSERT_EQUAL(objfun->ncalls, static_cast<size_t>(3));
+      ASSERT_TRUE(objfun->min_time >= 1.0e-3);
+      ASSERT_TRUE(objfun->min_time <= objfun->max_time);
+      ASSERT_TRUE(objfun->total_time >= 3.0 * objfun->min_time);
+      ASSERT_TRUE(objfun->total_time <= 3.0 * objfun->max_time);
+      ASSERT_EQUAL(profile.get("objgrd")->ncalls, static_cast<size_t>(1));
+      ASSERT_TRUE(profile.get("hess") == nullptr);
+      ASSERT_TRUE(profile.engine_time >= 2.0e-3);
+      ASSERT_TRUE(profile.total_time >=
+                  profile.engine_time + objfun->total_time);
+    }
+    {
+      SUB_TEST("reset at the start of each call");
+      {
+        utility::CallbackProfiler::SolveTimer solve_timer(&profiler, {"f"});
+        utility::CallbackProfiler::CallTimer timer(&profiler, 0);
+      }
+      const utility::CallbackProfile &profile = profiler.get_profile();
+      ASSERT_EQUAL(profile.callbacks.size(), static_cast<size_t>(1));
+      ASSERT_TRUE(profile.get("objfun") == nullptr);
+      ASSERT_EQUAL(profile.get("f")->ncalls, static_cast<size_t>(1));
+    }
+    {
+      SUB_TEST("no profiler attached");
+      utility::Optional opt;
+      ASSERT_TRUE(opt.callback_profiler == nullptr);
+      utility::CallbackProfiler::SolveTimer solve_timer(
+        opt.callback_profiler.get(), {"f"});
+      utility::CallbackProfiler::CallTimer timer(opt.callback_profiler.get(),
+                                                 0);
+      solve_timer.stop();
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_callback_profiler, "Test CallbackProfiler");
+// clang-format on
@@ -1,5 +1,7 @@
 // Test some of RawData implementation in nagcpp_data_handling_default.hpp
 // (additional tests are also in ut_data_handling_XD.cpp)
+// record any copies made, so that they can be tested for
+#define NAGCPP_TRACK_CONVERSION_COPIES
 #include "include/cxxunit_testing.hpp"
 #include "include/nagcpp_ut_generate_data.hpp"
 #include "utility/nagcpp_data_handling_default.hpp"
@@ -107,3 +109,84 @@ struct test_ulong_to_f77_integer : public TestCase {
 // clang-format off
 REGISTER_TEST(test_ulong_to_f77_integer, "Test unsigned long to f77_integer");
 // clang-format on
+
+struct test_borrow_matching_type : public TestCase {
+  void run() override {
+    std::vector<double> vd = ut::get_expected_values<double>(20);
+    const std::vector<double> &cvd = vd;
+    {
+      SUB_TEST("IntentIN, const container");
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             const std::vector<double>>
+        rd(cvd);
+      ASSERT_TRUE(rd.data == vd.data());
+    }
+    {
+      SUB_TEST("IntentIN, non-const container");
+      data_handling::RawData<double, data_handling::ArgIntent::IntentIN,
+                             std::vector<double>>
+        rd(vd);
+      ASSERT_TRUE(rd.data == vd.data());
+    }
+    {
+      SUB_TEST("IntentINOUT, non-const container");
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             std::vector<double>>
+        rd(vd);
+      ASSERT_TRUE(rd.data == vd.data());
+    }
+    {
+      SUB_TEST("IntentINOUT, const container");
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             std::vector<double>>
+        rd(cvd);
+      ASSERT_FALSE(rd.data == vd.data());
+      ASSERT_ARRAY_EQUAL(vd.size(), vd.data(), rd.data);
+    }
+  }
+};
+// clang-format off
+REGISTER_TEST(test_borrow_matching_type, "Test RawData uses the users data directly where possible");
+// clang-format on
+
+struct test_track_conversion_copies : public TestCase {
+  void run() override {
+    data_handling::reset_conversion_copies();
+    std::vector<float> vf = ut::get_expected_values<float>(20);
+    std::vector<double> vd = ut::get_expected_values<double>(10);
+    error_handler::ErrorHandler fail;
+    fail.prepare("test_track_conversion_copies");
+    {
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             std::vector<float>>
+        rdf(vf);
+      rdf.check(fail, "vf", true, 20);
+      rdf.copy_back(vf);
+      data_handling::RawData<double, data_handling::ArgIntent::IntentINOUT,
+                             std::vector<double>>
+        rdd(vd);
+      rdd.check(fail, "vd", true, 10);
+      rdd.copy_back(vd);
+    }
+    std::vector<data_handling::ConversionCopyRecord> copies =
+      data_handling::get_conversion_copies();
+    {
+      SUB_TEST("only the argument requiring a conversion is recorded");
+      ASSERT_EQUAL(copies.size(), static_cast<size_t>(1));
+    }
+    if (copies.size() == 1) {
+      SUB_TEST("record holds details of the copy");
+      ASSERT_STRINGS_EQUAL(copies[0].routine, "test_track_conversion_copies");
+      ASSERT_STRINGS_EQUAL(copies[0].argname, "vf");
+      ASSERT_EQUAL(copies[0].ncopies, static_cast<size_t>(1));
+      ASSERT_EQUAL(copies[0].bytes_in, 20 * sizeof(double));
+      ASSERT_EQUAL(copies[0].bytes_out, 20 * sizeof(double));
+    }
+    data_handling::reset_conversion_copies();
+    ASSERT_EQUAL(data_handling::get_conversion_copies().size(),
+                 static_cast<size_t>(0));
+  }
+};
+// clang-format off
+REGISTER_TEST(test_track_conversion_copies, "Test diagnostic logging of copies made by RawData");
+// clang-format on